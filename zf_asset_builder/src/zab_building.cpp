@@ -96,21 +96,21 @@ constexpr zcl::t_static_array<t_asset_field, ekm_sound_field_cnt> k_sound_fields
     zcl::t_texture_data_mut texture_data;
 
     if (!zcl::TextureLoadFromUnbuilt(file_path, temp_arena, temp_arena, &texture_data)) {
-        zcl::LogError(ZCL_STR_LITERAL("Failed to load texture from file \"%\"!"), file_path);
+        zcl::LogError("Failed to load texture from file \"%\"!", file_path);
         return false;
     }
 
     zcl::t_file_stream file_stream;
 
     if (!zcl::FileOpenRecursive(out_file_path, zcl::ek_file_access_mode_write, temp_arena, &file_stream, nullptr)) {
-        zcl::LogError(ZCL_STR_LITERAL("Failed to open texture output file \"%\" for writing!"), out_file_path);
+        zcl::LogError("Failed to open texture output file \"%\" for writing!", out_file_path);
         return false;
     }
 
     ZCL_DEFER({ zcl::FileClose(&file_stream); });
 
     if (!zcl::SerializeTexture(zcl::FileStreamGetView(&file_stream), texture_data)) {
-        zcl::LogError(ZCL_STR_LITERAL("Failed to serialize texture to file \"%\"!"), out_file_path);
+        zcl::LogError("Failed to serialize texture to file \"%\"!", out_file_path);
         return false;
     }
 
@@ -121,17 +121,17 @@ constexpr zcl::t_static_array<t_asset_field, ekm_sound_field_cnt> k_sound_fields
     const auto code_pt_bs = zcl::ArenaPush<zcl::t_code_point_bitset>(temp_arena);
 
     if (height <= 0) {
-        zcl::LogError(ZCL_STR_LITERAL("Invalid font height %! Must be greater than 0."), height);
+        zcl::LogError("Invalid font height %! Must be greater than 0.", height);
         return false;
     }
 
-    zcl::BitsetSetRange(*code_pt_bs, zcl::k_printable_ascii_range_begin, zcl::k_printable_ascii_range_end); // Add the printable ASCII range as a default.
+    zcl::HierarchicalBitsetSetRange(*code_pt_bs, zcl::k_printable_ascii_range_begin, zcl::k_printable_ascii_range_end); // Add the printable ASCII range as a default.
 
     if (!zcl::StrCheckEmpty(extra_chrs_file_path)) {
         zcl::t_array_mut<zcl::t_u8> extra_chrs_file_contents;
 
         if (!zcl::FileLoadContents(extra_chrs_file_path, temp_arena, temp_arena, &extra_chrs_file_contents)) {
-            zcl::LogError(ZCL_STR_LITERAL("Failed to load extra characters file \"%\"!"), extra_chrs_file_path);
+            zcl::LogError("Failed to load extra characters file \"%\"!", extra_chrs_file_path);
             return false;
         }
 
@@ -142,21 +142,21 @@ constexpr zcl::t_static_array<t_asset_field, ekm_sound_field_cnt> k_sound_fields
     zcl::t_array_mut<zcl::t_font_atlas_pixels_r8> atlas_pixels_arr;
 
     if (!zcl::FontLoadFromUnbuilt(file_path, height, code_pt_bs, temp_arena, temp_arena, temp_arena, &arrangement, &atlas_pixels_arr)) {
-        zcl::LogError(ZCL_STR_LITERAL("Failed to load font from file \"%\"!"), file_path);
+        zcl::LogError("Failed to load font from file \"%\"!", file_path);
         return false;
     }
 
     zcl::t_file_stream file_stream;
 
     if (!zcl::FileOpenRecursive(out_file_path, zcl::ek_file_access_mode_write, temp_arena, &file_stream)) {
-        zcl::LogError(ZCL_STR_LITERAL("Failed to open font output file \"%\" for writing!"), out_file_path);
+        zcl::LogError("Failed to open font output file \"%\" for writing!", out_file_path);
         return false;
     }
 
     ZCL_DEFER({ zcl::FileClose(&file_stream); });
 
     if (!zcl::SerializeFont(zcl::FileStreamGetView(&file_stream), arrangement, atlas_pixels_arr, temp_arena)) {
-        zcl::LogError(ZCL_STR_LITERAL("Failed to serialize font to file \"%\"!"), out_file_path);
+        zcl::LogError("Failed to serialize font to file \"%\"!", out_file_path);
         return false;
     }
 
@@ -171,28 +171,28 @@ constexpr zcl::t_static_array<t_asset_field, ekm_sound_field_cnt> k_sound_fields
     } else if (zcl::StrsCheckEqual(type, ZCL_STR_LITERAL("fragment"))) {
         is_frag = true;
     } else {
-        zcl::LogError(ZCL_STR_LITERAL("Invalid shader type \"%\"! Expected \"vertex\" or \"fragment\"."), type);
+        zcl::LogError("Invalid shader type \"%\"! Expected \"vertex\" or \"fragment\".", type);
         return false;
     }
 
     zcl::t_array_mut<zcl::t_u8> compiled_bin;
 
     if (!CompileShader(file_path, varying_def_file_path, is_frag, temp_arena, temp_arena, &compiled_bin)) {
-        zcl::LogError(ZCL_STR_LITERAL("Failed to compile shader from file \"%\"!"), file_path);
+        zcl::LogError("Failed to compile shader from file \"%\"!", file_path);
         return false;
     }
 
     zcl::t_file_stream shader_file_stream;
 
     if (!zcl::FileOpenRecursive(out_file_path, zcl::ek_file_access_mode_write, temp_arena, &shader_file_stream)) {
-        zcl::LogError(ZCL_STR_LITERAL("Failed to open shader output file \"%\" for writing!"), out_file_path);
+        zcl::LogError("Failed to open shader output file \"%\" for writing!", out_file_path);
         return false;
     }
 
     ZCL_DEFER({ zcl::FileClose(&shader_file_stream); });
 
     if (!zcl::SerializeShader(zcl::FileStreamGetView(&shader_file_stream), compiled_bin)) {
-        zcl::LogError(ZCL_STR_LITERAL("Failed to serialize shader to file \"%\"!"), out_file_path);
+        zcl::LogError("Failed to serialize shader to file \"%\"!", out_file_path);
         return false;
     }
 
@@ -203,21 +203,21 @@ constexpr zcl::t_static_array<t_asset_field, ekm_sound_field_cnt> k_sound_fields
     zcl::t_sound_data_mut snd_data;
 
     if (!zcl::SoundLoadFromUnbuilt(file_path, temp_arena, temp_arena, &snd_data)) {
-        zcl::LogError(ZCL_STR_LITERAL("Failed to load sound from file \"%\"!"), file_path);
+        zcl::LogError("Failed to load sound from file \"%\"!", file_path);
         return false;
     }
 
     zcl::t_file_stream file_stream;
 
     if (!zcl::FileOpenRecursive(out_file_path, zcl::ek_file_access_mode_write, temp_arena, &file_stream)) {
-        zcl::LogError(ZCL_STR_LITERAL("Failed to open sound output file \"%\" for writing!"), out_file_path);
+        zcl::LogError("Failed to open sound output file \"%\" for writing!", out_file_path);
         return false;
     }
 
     ZCL_DEFER({ zcl::FileClose(&file_stream); });
 
     if (!zcl::SerializeSound(zcl::FileStreamGetView(&file_stream), snd_data)) {
-        zcl::LogError(ZCL_STR_LITERAL("Failed to serialize sound to file \"%\"!"), out_file_path);
+        zcl::LogError("Failed to serialize sound to file \"%\"!", out_file_path);
         return false;
     }
 
@@ -234,14 +234,14 @@ zcl::t_b8 BuildAssets(const zcl::t_str_rdonly instrs_json_file_path) {
         zcl::t_array_mut<zcl::t_u8> instrs_json_file_contents; // Not needed beyond this scope.
 
         if (!zcl::FileLoadContents(instrs_json_file_path, arena, arena, &instrs_json_file_contents, true)) {
-            zcl::LogError(ZCL_STR_LITERAL("Failed to load build instructions JSON file \"%\"!"), instrs_json_file_path);
+            zcl::LogError("Failed to load build instructions JSON file \"%\"!", instrs_json_file_path);
             return false;
         }
 
         cj = cJSON_Parse(zcl::StrToCStr(zcl::t_str_rdonly{instrs_json_file_contents}));
 
         if (!cj) {
-            zcl::LogError(ZCL_STR_LITERAL("Failed to parse build instructions JSON file!"));
+            zcl::LogError("Failed to parse build instructions JSON file!");
             return false;
         }
     }
@@ -249,7 +249,7 @@ zcl::t_b8 BuildAssets(const zcl::t_str_rdonly instrs_json_file_path) {
     ZCL_DEFER({ cJSON_Delete(cj); });
 
     if (!cJSON_IsObject(cj)) {
-        zcl::LogError(ZCL_STR_LITERAL("Build instructions JSON root is not an object!"));
+        zcl::LogError("Build instructions JSON root is not an object!");
         return false;
     }
 
@@ -264,7 +264,7 @@ zcl::t_b8 BuildAssets(const zcl::t_str_rdonly instrs_json_file_path) {
         cJSON *const cj_assets = cJSON_GetObjectItemCaseSensitive(cj, asset_type_arr_name_c_str);
 
         if (!cJSON_IsArray(cj_assets)) {
-            zcl::LogError(ZCL_STR_LITERAL("Build instructions JSON \"%\" array does not exist or it is of the wrong type!"), zcl::CStrToStr(asset_type_arr_name_c_str));
+            zcl::LogError("Build instructions JSON \"%\" array does not exist or it is of the wrong type!", zcl::CStrToStr(asset_type_arr_name_c_str));
             return false;
         }
 
@@ -274,7 +274,7 @@ zcl::t_b8 BuildAssets(const zcl::t_str_rdonly instrs_json_file_path) {
         cJSON_ArrayForEach(cj_asset, cj_assets) {
             ZCL_DEFER({ cj_asset_index++; });
 
-            zcl::Log(ZCL_STR_LITERAL("Building \"%\" asset %..."), zcl::CStrToStr(asset_type_arr_name_c_str), cj_asset_index);
+            zcl::Log("Building \"%\" asset %...", zcl::CStrToStr(asset_type_arr_name_c_str), cj_asset_index);
 
             {
                 zcl::t_file_stream std_out = zcl::FileStreamCreateStdOut();
@@ -284,7 +284,7 @@ zcl::t_b8 BuildAssets(const zcl::t_str_rdonly instrs_json_file_path) {
             zcl::ArenaRewind(arena);
 
             if (!cJSON_IsObject(cj_asset)) {
-                zcl::LogError(ZCL_STR_LITERAL("JSON entry is of the wrong type! Expected an object."));
+                zcl::LogError("JSON entry is of the wrong type! Expected an object.");
                 return false;
             }
 
@@ -346,7 +346,7 @@ zcl::t_b8 BuildAssets(const zcl::t_str_rdonly instrs_json_file_path) {
                         continue;
                     }
 
-                    zcl::LogError(ZCL_STR_LITERAL("JSON entry is missing required field \"%\"!"), zcl::CStrToStr(field_name_c_str));
+                    zcl::LogError("JSON entry is missing required field \"%\"!", zcl::CStrToStr(field_name_c_str));
 
                     return false;
                 }
@@ -369,7 +369,7 @@ zcl::t_b8 BuildAssets(const zcl::t_str_rdonly instrs_json_file_path) {
 
                 if (!is_valid) {
                     const auto type_name = zcl::CStrToStr(k_asset_field_type_name_c_strs[fields[fi].type]);
-                    zcl::LogError(ZCL_STR_LITERAL("JSON entry has field \"%\" as the wrong type! Expected a %."), zcl::CStrToStr(field_name_c_str), type_name);
+                    zcl::LogError("JSON entry has field \"%\" as the wrong type! Expected a %.", zcl::CStrToStr(field_name_c_str), type_name);
                     return false;
                 }
             }
@@ -424,7 +424,7 @@ zcl::t_b8 BuildAssets(const zcl::t_str_rdonly instrs_json_file_path) {
                 }
             }
 
-            zcl::Log(ZCL_STR_LITERAL("Built successfully!\n"));
+            zcl::Log("Built successfully!\n");
 
             {
                 zcl::t_file_stream std_out = zcl::FileStreamCreateStdOut();
@@ -433,7 +433,7 @@ zcl::t_b8 BuildAssets(const zcl::t_str_rdonly instrs_json_file_path) {
         }
     }
 
-    zcl::Log(ZCL_STR_LITERAL("Asset building completed!"));
+    zcl::Log("Asset building completed!");
 
     return true;
 }
@@ -4,7 +4,7 @@ int main(const int arg_cnt, const char *const *const args_raw) {
     const zcl::t_array_rdonly<const char *> args = {args_raw, arg_cnt};
 
     if (args.len != 2) {
-        zcl::LogError(ZCL_STR_LITERAL("Invalid number of command-line arguments provided! Expected a path to a build instructions JSON file."));
+        zcl::LogError("Invalid number of command-line arguments provided! Expected a path to a build instructions JSON file.");
         return 1;
     }
 
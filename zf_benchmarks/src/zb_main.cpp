@@ -0,0 +1,768 @@
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include <zcl.h>
+#include <zgl.h>
+
+// The platform module can only give the time once a window exists, so go through the standard library instead.
+static zcl::t_f64 GetTimeNow() {
+    return std::chrono::duration<zcl::t_f64>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+constexpr zcl::t_f64 k_bench_duration_min = 0.25;
+
+// Calls the function repeatedly for at least the minimum duration, returning the average number of seconds per call.
+template <typename tp_func_type>
+static zcl::t_f64 BenchMeasure(const tp_func_type &func) {
+    zcl::t_i32 call_cnt = 0;
+
+    const zcl::t_f64 time_begin = GetTimeNow();
+    zcl::t_f64 time_elapsed;
+
+    do {
+        func();
+        call_cnt++;
+        time_elapsed = GetTimeNow() - time_begin;
+    } while (time_elapsed < k_bench_duration_min);
+
+    return time_elapsed / static_cast<zcl::t_f64>(call_cnt);
+}
+
+static void BenchReport(const zcl::t_str_rdonly title, const zcl::t_i32 glyph_cnt, const zcl::t_f64 secs_per_call) {
+    const zcl::t_f64 glyphs_per_sec = static_cast<zcl::t_f64>(glyph_cnt) / secs_per_call;
+    zcl::Log("    % - % glyphs/s (% us per call)", title, zcl::FormatFloat(glyphs_per_sec, 0), zcl::FormatFloat(secs_per_call * 1000000.0, 2));
+}
+
+// ============================================================
+// @section: Synthetic Fonts
+
+constexpr zcl::t_code_point k_code_pt_printable_first = ' ';
+constexpr zcl::t_code_point k_code_pt_printable_last = '~';
+
+constexpr zcl::t_code_point k_code_pt_combining_first = 0x0300;
+constexpr zcl::t_code_point k_code_pt_combining_last = 0x030F;
+
+constexpr zcl::t_code_point k_code_pt_hebrew_first = 0x05D0;
+constexpr zcl::t_code_point k_code_pt_hebrew_last = 0x05EA;
+
+constexpr zcl::t_static_array<zcl::t_i32, 3> k_font_heights = {{12, 24, 48}};
+constexpr zcl::t_static_array<zcl::t_f32, 3> k_font_kerning_densities = {{0.0f, 0.05f, 0.25f}};
+
+// Builds a font without going through the file system, so that results do not depend on whichever font file happens to be around. Metrics are derived from the height, and the given proportion of printable ASCII pairs get a kerning.
+static zgl::t_font BenchFontCreate(const zcl::t_i32 height, const zcl::t_f32 kerning_density, const zcl::t_array_mut<zgl::t_gfx_resource *> atlas_textures, zcl::t_rng *const rng, zcl::t_arena *const arena) {
+    zcl::t_font_arrangement arrangement = {
+        .line_height = height + (height / 4),
+        .ascent = height + (height / 4), // Every glyph sits on the baseline, with nothing below it.
+    };
+
+    arrangement.code_pts_to_glyph_infos = zcl::HashMapCreate<zcl::t_code_point, zcl::t_font_glyph_info>(zcl::k_font_code_point_hash_func, arena, zcl::k_comparator_bin_default<zcl::t_code_point>, 256);
+
+    const zcl::t_v2_i glyph_size = {zcl::CalcMax((height * 3) / 5, 1), height};
+    const zcl::t_i32 atlas_col_cnt = zcl::k_font_atlas_texture_size.x / (glyph_size.x + 2);
+    zcl::t_i32 atlas_slot_index = 0;
+
+    const auto put_glyphs = [&](const zcl::t_code_point first, const zcl::t_code_point last, const zcl::t_b8 zero_adv) {
+        for (zcl::t_code_point code_pt = first; code_pt <= last; code_pt++) {
+            const zcl::t_font_glyph_info glyph_info = {
+                .offs = {0, height / 4},
+                .size = glyph_size,
+                .adv = zero_adv ? 0 : glyph_size.x,
+                .atlas_index = 0,
+                .atlas_rect = {(atlas_slot_index % atlas_col_cnt) * (glyph_size.x + 2), (atlas_slot_index / atlas_col_cnt) * (glyph_size.y + 2), glyph_size.x, glyph_size.y},
+            };
+
+            zcl::HashMapPut(&arrangement.code_pts_to_glyph_infos, code_pt, glyph_info);
+            atlas_slot_index++;
+        }
+    };
+
+    put_glyphs(k_code_pt_printable_first, k_code_pt_printable_last, false);
+    put_glyphs(k_code_pt_combining_first, k_code_pt_combining_last, true);
+    put_glyphs(k_code_pt_hebrew_first, k_code_pt_hebrew_last, false);
+
+    arrangement.has_kernings = kerning_density > 0.0f;
+    arrangement.code_pt_pairs_to_kernings = zcl::HashMapCreate<zcl::t_font_code_point_pair, zcl::t_i32>(zcl::k_font_code_point_pair_hash_func, arena, zcl::k_font_code_point_pair_comparator);
+
+    if (arrangement.has_kernings) {
+        for (zcl::t_code_point a = k_code_pt_printable_first; a <= k_code_pt_printable_last; a++) {
+            for (zcl::t_code_point b = k_code_pt_printable_first; b <= k_code_pt_printable_last; b++) {
+                if (zcl::RandGenPerc(rng) < kerning_density) {
+                    zcl::HashMapPut(&arrangement.code_pt_pairs_to_kernings, {a, b}, -1);
+                }
+            }
+        }
+    }
+
+    zcl::FontBuildGlyphTable(&arrangement, arena);
+
+    return {
+        .arrangement = arrangement,
+        .atlas_textures = atlas_textures,
+    };
+}
+
+// ==================================================
+
+// ============================================================
+// @section: Strings
+
+constexpr zcl::t_static_array<zcl::t_i32, 3> k_str_lens = {{16, 256, 4096}};
+
+constexpr zcl::t_i32 k_str_line_len_approx = 64;
+
+enum t_str_script : zcl::t_i32 {
+    ek_str_script_latin,
+    ek_str_script_latin_with_marks, // Some letters followed by a combining mark.
+    ek_str_script_mixed_rtl         // Some words in Hebrew.
+};
+
+// Generates random words separated by spaces, with a line break roughly every so often if requested. The length is in code points.
+static zcl::t_str_mut BenchStrGenerate(const zcl::t_i32 len, const t_str_script script, const zcl::t_b8 line_breaks, zcl::t_rng *const rng, zcl::t_arena *const arena) {
+    ZCL_ASSERT(len > 0);
+
+    // No code point used here takes more than 2 bytes.
+    const auto bytes = zcl::ArenaPushArray<zcl::t_u8>(arena, len * 2);
+    zcl::t_i32 byte_cnt = 0;
+
+    const auto append = [&](const zcl::t_code_point code_pt) {
+        if (code_pt < 0x80) {
+            bytes[byte_cnt] = static_cast<zcl::t_u8>(code_pt);
+            byte_cnt++;
+        } else {
+            bytes[byte_cnt] = static_cast<zcl::t_u8>(0xC0 | (code_pt >> 6));
+            bytes[byte_cnt + 1] = static_cast<zcl::t_u8>(0x80 | (code_pt & 0x3F));
+            byte_cnt += 2;
+        }
+    };
+
+    zcl::t_i32 code_pt_cnt = 0;
+    zcl::t_i32 line_len = 0;
+
+    while (code_pt_cnt < len) {
+        const zcl::t_i32 word_len = zcl::CalcMin(zcl::RandGenI32InRange(rng, 1, 10), len - code_pt_cnt);
+        const zcl::t_b8 word_rtl = script == ek_str_script_mixed_rtl && zcl::RandGenPerc(rng) < 0.3f;
+
+        for (zcl::t_i32 i = 0; i < word_len; i++) {
+            if (word_rtl) {
+                append(k_code_pt_hebrew_first + static_cast<zcl::t_code_point>(zcl::RandGenI32InRange(rng, 0, static_cast<zcl::t_i16>(k_code_pt_hebrew_last - k_code_pt_hebrew_first + 1))));
+            } else if (script == ek_str_script_latin_with_marks && i > 0 && zcl::RandGenPerc(rng) < 0.2f) {
+                append(k_code_pt_combining_first + static_cast<zcl::t_code_point>(zcl::RandGenI32InRange(rng, 0, static_cast<zcl::t_i16>(k_code_pt_combining_last - k_code_pt_combining_first + 1))));
+            } else {
+                append(static_cast<zcl::t_code_point>('a' + zcl::RandGenI32InRange(rng, 0, 26)));
+            }
+        }
+
+        code_pt_cnt += word_len;
+        line_len += word_len;
+
+        if (code_pt_cnt < len) {
+            if (line_breaks && line_len >= k_str_line_len_approx) {
+                append('\n');
+                line_len = 0;
+            } else {
+                append(' ');
+            }
+
+            code_pt_cnt++;
+        }
+    }
+
+    return {zcl::ArraySlice(bytes, 0, byte_cnt)};
+}
+
+static zcl::t_i32 BenchStrCountGlyphs(const zcl::t_str_rdonly str) {
+    zcl::t_i32 result = 0;
+
+    ZCL_STR_WALK (str, step) {
+        if (step.code_pt != ' ' && step.code_pt != '\n') {
+            result++;
+        }
+    }
+
+    return result;
+}
+
+// ==================================================
+
+// ============================================================
+// @section: Benchmarks
+
+struct t_bench_context {
+    zcl::t_arena *perm_arena;
+    zcl::t_arena *temp_arena;
+    zcl::t_rng *rng;
+
+    zgl::t_gfx_ticket_mut gfx_ticket;
+    const zgl::t_rendering_basis *rendering_basis;
+    zcl::t_array_mut<zgl::t_gfx_resource *> atlas_textures;
+
+    zcl::t_str_rdonly font_file_path; // Empty if none was provided.
+};
+
+constexpr zcl::t_v2_i k_backbuffer_size = {1280, 720};
+constexpr zcl::t_i32 k_frame_vertex_limit = 1 << 16;
+
+static void BenchCalcStrRenderInfo(const t_bench_context &context) {
+    for (zcl::t_i32 hi = 0; hi < k_font_heights.k_len; hi++) {
+        for (zcl::t_i32 ki = 0; ki < k_font_kerning_densities.k_len; ki++) {
+            const zgl::t_font font = BenchFontCreate(k_font_heights[hi], k_font_kerning_densities[ki], context.atlas_textures, context.rng, context.perm_arena);
+
+            for (zcl::t_i32 li = 0; li < k_str_lens.k_len; li++) {
+                const zcl::t_str_rdonly str = BenchStrGenerate(k_str_lens[li], ek_str_script_latin, true, context.rng, context.perm_arena);
+
+                const zcl::t_f64 secs = BenchMeasure([&]() {
+                    zgl::CalcStrRenderInfo(str, font.arrangement, zcl::k_origin_center, context.temp_arena);
+                    zcl::ArenaRewind(context.temp_arena);
+                });
+
+                zcl::Log("  height %, kerning density %, length %", k_font_heights[hi], k_font_kerning_densities[ki], k_str_lens[li]);
+                BenchReport(ZCL_STR_LITERAL("CalcStrRenderInfo"), BenchStrCountGlyphs(str), secs);
+            }
+        }
+    }
+}
+
+static void BenchCalcStrRenderInfoShaped(const t_bench_context &context) {
+    const zgl::t_font font = BenchFontCreate(24, 0.05f, context.atlas_textures, context.rng, context.perm_arena);
+
+    const zcl::t_static_array<zcl::t_str_rdonly, 3> script_names = {{
+        ZCL_STR_LITERAL("latin"),
+        ZCL_STR_LITERAL("latin with marks"),
+        ZCL_STR_LITERAL("mixed rtl"),
+    }};
+
+    for (zcl::t_i32 si = 0; si < script_names.k_len; si++) {
+        for (zcl::t_i32 li = 0; li < k_str_lens.k_len; li++) {
+            const zcl::t_str_rdonly str = BenchStrGenerate(k_str_lens[li], static_cast<t_str_script>(si), true, context.rng, context.perm_arena);
+
+            const zcl::t_f64 secs = BenchMeasure([&]() {
+                zgl::CalcStrRenderInfoShaped(str, font.arrangement, zcl::k_origin_center, zcl::FontShapeSimple, context.temp_arena, context.temp_arena);
+                zcl::ArenaRewind(context.temp_arena);
+            });
+
+            zcl::Log("  script %, length %", script_names[si], k_str_lens[li]);
+            BenchReport(ZCL_STR_LITERAL("CalcStrRenderInfoShaped"), BenchStrCountGlyphs(str), secs);
+        }
+    }
+}
+
+static void BenchTextLayout(const t_bench_context &context) {
+    const zgl::t_font font = BenchFontCreate(24, 0.05f, context.atlas_textures, context.rng, context.perm_arena);
+
+    // Spans in differently sized fonts on one line must share a baseline, which for these fonts is where every glyph ends.
+    {
+        const zgl::t_font font_small = BenchFontCreate(k_font_heights[0], 0.0f, context.atlas_textures, context.rng, context.perm_arena);
+        const zgl::t_font font_large = BenchFontCreate(k_font_heights[k_font_heights.k_len - 1], 0.0f, context.atlas_textures, context.rng, context.perm_arena);
+
+        const zcl::t_static_array<zgl::t_text_span, 3> spans = {{
+            {.str = ZCL_STR_LITERAL("small "), .font = &font_small, .color = zcl::k_color_white},
+            {.str = ZCL_STR_LITERAL("LARGE"), .font = &font_large, .color = zcl::k_color_white},
+            {.str = ZCL_STR_LITERAL(" small"), .font = &font_small, .color = zcl::k_color_white},
+        }};
+
+        const zgl::t_str_layout_mut layout = zgl::TextLayoutCreate(zcl::ArrayToNonstatic(&spans), 0.0f, zgl::ek_text_align_left, context.temp_arena, context.temp_arena);
+        ZCL_REQUIRE(layout.triangles.len > 0);
+
+        const auto calc_bottom = [](const zgl::t_gfx_triangle &triangle) {
+            return zcl::CalcMax(zcl::CalcMax(triangle.vertices[0].pos.y, triangle.vertices[1].pos.y), triangle.vertices[2].pos.y);
+        };
+
+        const zcl::t_f32 baseline = calc_bottom(layout.triangles[0]);
+
+        for (zcl::t_i32 i = 0; i < layout.triangles.len; i++) {
+            ZCL_REQUIRE(zcl::CheckNearlyEqual(calc_bottom(layout.triangles[i]), baseline, 0.01f));
+        }
+
+        zcl::ArenaRewind(context.temp_arena);
+    }
+
+    constexpr zcl::t_static_array<zcl::t_f32, 3> k_wrap_widths = {{0.0f, 320.0f, 960.0f}};
+
+    for (zcl::t_i32 wi = 0; wi < k_wrap_widths.k_len; wi++) {
+        for (zcl::t_i32 li = 0; li < k_str_lens.k_len; li++) {
+            const zgl::t_text_span span = {
+                .str = BenchStrGenerate(k_str_lens[li], ek_str_script_latin, false, context.rng, context.perm_arena),
+                .font = &font,
+                .color = zcl::k_color_white,
+            };
+
+            const zcl::t_i32 glyph_cnt = BenchStrCountGlyphs(span.str);
+
+            zcl::Log("  wrap width %, length %", k_wrap_widths[wi], k_str_lens[li]);
+
+            const zcl::t_f64 measure_secs = BenchMeasure([&]() {
+                zgl::TextMeasure({&span, 1}, k_wrap_widths[wi], context.temp_arena);
+                zcl::ArenaRewind(context.temp_arena);
+            });
+
+            BenchReport(ZCL_STR_LITERAL("TextMeasure"), glyph_cnt, measure_secs);
+
+            const zcl::t_f64 layout_secs = BenchMeasure([&]() {
+                zgl::TextLayoutCreate({&span, 1}, k_wrap_widths[wi], zgl::ek_text_align_justified, context.temp_arena, context.temp_arena);
+                zcl::ArenaRewind(context.temp_arena);
+            });
+
+            BenchReport(ZCL_STR_LITERAL("TextLayoutCreate (justified)"), glyph_cnt, layout_secs);
+        }
+    }
+}
+
+static void BenchRendererSubmitStr(const t_bench_context &context) {
+    zcl::t_arena *const layout_arena = zcl::ArenaCreateBlockBased();
+    ZCL_DEFER({ zcl::ArenaDestroy(layout_arena); });
+
+    const auto run_frame = [&context](const auto &submit_func) {
+        const zgl::t_rendering_context rc = zgl::internal::RendererBegin(context.rendering_basis, context.gfx_ticket, k_backbuffer_size, context.temp_arena);
+        zgl::RendererPassBegin(rc, k_backbuffer_size);
+        submit_func(rc);
+        zgl::RendererPassEnd(rc);
+        zgl::internal::RendererEnd(rc);
+
+        zcl::ArenaRewind(context.temp_arena);
+    };
+
+    for (zcl::t_i32 hi = 0; hi < k_font_heights.k_len; hi++) {
+        const zgl::t_font font = BenchFontCreate(k_font_heights[hi], 0.05f, context.atlas_textures, context.rng, context.perm_arena);
+
+        for (zcl::t_i32 li = 0; li < k_str_lens.k_len; li++) {
+            const zcl::t_str_rdonly str = BenchStrGenerate(k_str_lens[li], ek_str_script_latin, true, context.rng, context.perm_arena);
+            const zcl::t_i32 glyph_cnt = BenchStrCountGlyphs(str);
+
+            zcl::Log("  height %, length %", k_font_heights[hi], k_str_lens[li]);
+
+            const zcl::t_f64 str_secs = BenchMeasure([&]() {
+                run_frame([&](const zgl::t_rendering_context rc) {
+                    zgl::RendererSubmitStr(rc, str, font, {}, zcl::k_color_white, context.temp_arena, zcl::k_origin_top_left, 0.3f);
+                });
+            });
+
+            BenchReport(ZCL_STR_LITERAL("RendererSubmitStr"), glyph_cnt, str_secs);
+
+            const zgl::t_str_layout_rdonly layout = zgl::StrLayoutCreate(str, font, zcl::k_color_white, layout_arena, context.temp_arena, zcl::k_origin_top_left, 0.3f);
+            zcl::ArenaRewind(context.temp_arena);
+
+            const zcl::t_f64 layout_secs = BenchMeasure([&]() {
+                run_frame([&](const zgl::t_rendering_context rc) {
+                    zgl::RendererSubmitStrLayout(rc, layout, {});
+                });
+            });
+
+            BenchReport(ZCL_STR_LITERAL("RendererSubmitStrLayout"), glyph_cnt, layout_secs);
+
+            zcl::ArenaRewind(layout_arena);
+        }
+    }
+}
+
+static void BenchFontLoad(const t_bench_context &context) {
+    if (zcl::StrCheckEmpty(context.font_file_path)) {
+        zcl::Log("  Skipped, since no font file path was provided.");
+        return;
+    }
+
+    for (zcl::t_i32 hi = 0; hi < k_font_heights.k_len; hi++) {
+        zcl::t_i32 glyph_cnt = 0;
+
+        const zcl::t_f64 secs = BenchMeasure([&]() {
+            const auto code_pts = zcl::ArenaPush<zcl::t_code_point_bitset>(context.temp_arena);
+            zcl::HierarchicalBitsetSetRange(*code_pts, k_code_pt_printable_first, k_code_pt_printable_last + 1);
+
+            zcl::t_font_arrangement arrangement;
+            zcl::t_array_mut<zcl::t_font_atlas_pixels_r8> atlas_pixels_arr;
+
+            if (!zcl::FontLoadFromUnbuilt(context.font_file_path, k_font_heights[hi], code_pts, context.temp_arena, context.temp_arena, context.temp_arena, &arrangement, &atlas_pixels_arr)) {
+                ZCL_FATAL();
+            }
+
+            glyph_cnt = zcl::HierarchicalBitsetCountSet(*code_pts);
+
+            zcl::ArenaRewind(context.temp_arena);
+        });
+
+        zcl::Log("  height %", k_font_heights[hi]);
+        BenchReport(ZCL_STR_LITERAL("FontLoadFromUnbuilt"), glyph_cnt, secs);
+    }
+}
+
+// Runs the parallel algorithms with growing worker counts, reporting the speedup of each over running on the calling thread alone.
+// Compares each of the O(n log n) sorts against std::sort on a range of input orders. Every measurement includes restoring the unsorted input, so the times are for copy and sort together.
+static void BenchSorting(const t_bench_context &context) {
+    constexpr zcl::t_i32 k_len = 1 << 17;
+
+    enum t_input {
+        ek_input_random,
+        ek_input_sorted,
+        ek_input_reversed,
+        ek_input_few_unique,
+
+        ekm_input_cnt,
+    };
+
+    const zcl::t_static_array<zcl::t_str_rdonly, ekm_input_cnt> input_names = {{ZCL_STR_LITERAL("random"), ZCL_STR_LITERAL("sorted"), ZCL_STR_LITERAL("reversed"), ZCL_STR_LITERAL("few unique")}};
+
+    const auto nums_src = zcl::ArenaPushArray<zcl::t_i32>(context.temp_arena, k_len);
+    const auto nums = zcl::ArenaPushArray<zcl::t_i32>(context.temp_arena, k_len);
+
+    zcl::t_arena *const sort_arena = zcl::ArenaCreateBlockBased();
+    ZCL_DEFER({ zcl::ArenaDestroy(sort_arena); });
+
+    zcl::Log("  % elements", k_len);
+
+    for (zcl::t_i32 i = 0; i < ekm_input_cnt; i++) {
+        for (zcl::t_i32 j = 0; j < nums_src.len; j++) {
+            nums_src[j] = i == ek_input_few_unique ? zcl::RandGenI32InRange(context.rng, 0, 16) : zcl::RandGenI32(context.rng);
+        }
+
+        if (i == ek_input_sorted || i == ek_input_reversed) {
+            std::sort(nums_src.raw, nums_src.raw + nums_src.len);
+
+            if (i == ek_input_reversed) {
+                zcl::Reverse(nums_src);
+            }
+        }
+
+        const auto measure = [nums_src, nums, sort_arena](const auto &sort_func) {
+            return BenchMeasure([&]() {
+                zcl::ArrayCopy(nums_src, nums);
+                sort_func();
+                zcl::ArenaRewind(sort_arena);
+            });
+        };
+
+        const zcl::t_f64 std_secs = measure([nums]() { std::sort(nums.raw, nums.raw + nums.len); });
+        const zcl::t_f64 quick_secs = measure([nums]() { zcl::RunQuickSort(nums); });
+        const zcl::t_f64 merge_secs = measure([nums, sort_arena]() { zcl::RunMergeSort(nums, sort_arena); });
+        const zcl::t_f64 heap_secs = measure([nums]() { zcl::RunHeapSort(nums); });
+        const zcl::t_f64 radix_secs = measure([nums, sort_arena]() { zcl::RunRadixSort(nums, sort_arena); });
+
+        const auto format_secs = [](const zcl::t_f64 secs) {
+            return zcl::FormatFloat(secs * 1000.0, 2);
+        };
+
+        const auto format_ratio = [std_secs](const zcl::t_f64 secs) {
+            return zcl::FormatFloat(secs / std_secs, 2);
+        };
+
+        zcl::Log("    % - std::sort % ms, quick % ms (x%), merge % ms (x%), heap % ms (x%), radix % ms (x%)", input_names[i], format_secs(std_secs), format_secs(quick_secs), format_ratio(quick_secs), format_secs(merge_secs), format_ratio(merge_secs), format_secs(heap_secs), format_ratio(heap_secs), format_secs(radix_secs), format_ratio(radix_secs));
+    }
+}
+
+static void BenchParallelAlgos(const t_bench_context &context) {
+    constexpr zcl::t_i32 k_len = 1 << 20;
+
+    const auto nums_src = zcl::ArenaPushArray<zcl::t_i32>(context.temp_arena, k_len);
+
+    for (zcl::t_i32 i = 0; i < nums_src.len; i++) {
+        nums_src[i] = zcl::RandGenI32(context.rng);
+    }
+
+    const auto nums = zcl::ArenaPushArray<zcl::t_i32>(context.temp_arena, k_len);
+    const auto results = zcl::ArenaPushArray<zcl::t_f32>(context.temp_arena, k_len);
+
+    const zcl::t_i32 worker_cnt_max = zcl::WorkerPoolGetDefaultWorkerCount();
+
+    zcl::t_f64 sort_secs_serial = 0.0;
+    zcl::t_f64 count_secs_serial = 0.0;
+    zcl::t_f64 transform_secs_serial = 0.0;
+
+    zcl::Log("  % elements, up to % workers", k_len, worker_cnt_max);
+
+    // Worker counts double each step, with the maximum always included last.
+    for (zcl::t_i32 worker_cnt = 0; worker_cnt <= worker_cnt_max; worker_cnt = worker_cnt == worker_cnt_max ? worker_cnt + 1 : zcl::CalcMin(zcl::CalcMax(worker_cnt * 2, 1), worker_cnt_max)) {
+        zcl::t_worker_pool *const pool = zcl::WorkerPoolCreate(worker_cnt, context.perm_arena);
+        ZCL_DEFER({ zcl::WorkerPoolDestroy(pool); });
+
+        zcl::t_arena *const sort_arena = zcl::ArenaCreateBlockBased();
+        ZCL_DEFER({ zcl::ArenaDestroy(sort_arena); });
+
+        const zcl::t_f64 sort_secs = BenchMeasure([&]() {
+            zcl::ArrayCopy(nums_src, nums);
+            zcl::ParallelSort(pool, nums, sort_arena);
+            zcl::ArenaRewind(sort_arena);
+        });
+
+        zcl::t_i32 cnt = 0;
+
+        const zcl::t_f64 count_secs = BenchMeasure([&]() {
+            cnt = zcl::ParallelCount(pool, nums_src, [](const zcl::t_i32 &num) { return num % 3 == 0; });
+        });
+
+        const zcl::t_f64 transform_secs = BenchMeasure([&]() {
+            zcl::ParallelTransform(pool, nums_src, results, [](const zcl::t_i32 &num) { return zcl::CalcMag({static_cast<zcl::t_f32>(num & 0xFF), static_cast<zcl::t_f32>((num >> 8) & 0xFF)}); });
+        });
+
+        if (worker_cnt == 0) {
+            sort_secs_serial = sort_secs;
+            count_secs_serial = count_secs;
+            transform_secs_serial = transform_secs;
+        }
+
+        zcl::Log("    % threads - sort % ms (x%), count % ms (x%), transform % ms (x%)", worker_cnt + 1, zcl::FormatFloat(sort_secs * 1000.0, 2), zcl::FormatFloat(sort_secs_serial / sort_secs, 2), zcl::FormatFloat(count_secs * 1000.0, 2), zcl::FormatFloat(count_secs_serial / count_secs, 2), zcl::FormatFloat(transform_secs * 1000.0, 2), zcl::FormatFloat(transform_secs_serial / transform_secs, 2));
+    }
+}
+
+// Measures how many values per second get through each ring kind, with every producer and consumer on its own thread.
+static void BenchRings(const t_bench_context &context) {
+    constexpr zcl::t_i32 k_cap = 1024;
+    constexpr zcl::t_i32 k_value_cnt = 1 << 20;
+
+    const auto report = [](const zcl::t_str_rdonly title, const zcl::t_f64 secs) {
+        zcl::Log("    % - % values/s (% ns per value)", title, zcl::FormatFloat(static_cast<zcl::t_f64>(k_value_cnt) / secs, 0), zcl::FormatFloat((secs * 1000000000.0) / static_cast<zcl::t_f64>(k_value_cnt), 2));
+    };
+
+    zcl::Log("  % values, capacity %", k_value_cnt, k_cap);
+
+    {
+        zcl::t_spsc_ring<zcl::t_i32> *const ring = zcl::SPSCRingCreate<zcl::t_i32>(k_cap, context.temp_arena);
+
+        const zcl::t_f64 secs = BenchMeasure([ring]() {
+            std::thread producer([ring]() {
+                for (zcl::t_i32 i = 0; i < k_value_cnt; i++) {
+                    while (!zcl::SPSCRingPush(ring, i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+            for (zcl::t_i32 i = 0; i < k_value_cnt; i++) {
+                zcl::t_i32 value;
+
+                while (!zcl::SPSCRingPop(ring, &value)) {
+                    std::this_thread::yield();
+                }
+            }
+
+            producer.join();
+        });
+
+        report(ZCL_STR_LITERAL("SPSC, 1 producer, 1 consumer"), secs);
+    }
+
+    constexpr zcl::t_static_array<zcl::t_i32, 3> k_thread_pair_cnts = {{1, 2, 4}};
+
+    for (zcl::t_i32 pci = 0; pci < k_thread_pair_cnts.k_len; pci++) {
+        const zcl::t_i32 pair_cnt = k_thread_pair_cnts[pci];
+
+        zcl::t_mpmc_ring<zcl::t_i32> *const ring = zcl::MPMCRingCreate<zcl::t_i32>(k_cap, context.temp_arena);
+
+        // Every task gets its own thread, since producers and consumers wait on each other.
+        zcl::t_worker_pool *const pool = zcl::WorkerPoolCreate((pair_cnt * 2) - 1, context.perm_arena);
+        ZCL_DEFER({ zcl::WorkerPoolDestroy(pool); });
+
+        const zcl::t_f64 secs = BenchMeasure([ring, pool, pair_cnt]() {
+            const zcl::t_i32 value_cnt_per_thread = k_value_cnt / pair_cnt;
+
+            zcl::WorkerPoolRun(pool, pair_cnt * 2, [ring, pair_cnt, value_cnt_per_thread](const zcl::t_i32 task_index) {
+                for (zcl::t_i32 i = 0; i < value_cnt_per_thread; i++) {
+                    if (task_index < pair_cnt) {
+                        while (!zcl::MPMCRingPush(ring, i)) {
+                            std::this_thread::yield();
+                        }
+                    } else {
+                        zcl::t_i32 value;
+
+                        while (!zcl::MPMCRingPop(ring, &value)) {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+            });
+        });
+
+        zcl::Log("    % producers, % consumers", pair_cnt, pair_cnt);
+        report(ZCL_STR_LITERAL("MPMC"), secs);
+    }
+}
+
+// Measures printing numbers into memory, against snprintf doing the same.
+static void BenchPrintNumbers(const t_bench_context &context) {
+    constexpr zcl::t_i32 k_value_cnt = 4096;
+
+    const auto ints = zcl::ArenaPushArray<zcl::t_i32>(context.temp_arena, k_value_cnt);
+    const auto floats = zcl::ArenaPushArray<zcl::t_f32>(context.temp_arena, k_value_cnt);
+
+    for (zcl::t_i32 i = 0; i < k_value_cnt; i++) {
+        ints[i] = zcl::RandGenI32(context.rng);
+        floats[i] = zcl::RandGenF32InRange(context.rng, -10000.0f, 10000.0f);
+    }
+
+    const auto report = [](const zcl::t_str_rdonly title, const zcl::t_f64 secs) {
+        zcl::Log("    % - % ns per value", title, zcl::FormatFloat((secs * 1000000000.0) / static_cast<zcl::t_f64>(k_value_cnt), 2));
+    };
+
+    zcl::t_mem_stream stream = zcl::MemStreamCreate(context.temp_arena, 1 << 16);
+    const auto buf = zcl::ArenaPushArray<char>(context.temp_arena, 1 << 16);
+
+    report(ZCL_STR_LITERAL("Integers, PrintFormat"), BenchMeasure([&stream, ints]() {
+        zcl::MemStreamClear(&stream);
+
+        for (zcl::t_i32 i = 0; i < ints.len; i++) {
+            zcl::PrintFormat(zcl::MemStreamGetView(&stream), "% ", ints[i]);
+        }
+    }));
+
+    report(ZCL_STR_LITERAL("Integers, snprintf"), BenchMeasure([buf, ints]() {
+        zcl::t_i32 pos = 0;
+
+        for (zcl::t_i32 i = 0; i < ints.len; i++) {
+            pos += snprintf(buf.raw + pos, static_cast<size_t>(buf.len - pos), "%d ", ints[i]);
+        }
+    }));
+
+    report(ZCL_STR_LITERAL("Floats (shortest), PrintFormat"), BenchMeasure([&stream, floats]() {
+        zcl::MemStreamClear(&stream);
+
+        for (zcl::t_i32 i = 0; i < floats.len; i++) {
+            zcl::PrintFormat(zcl::MemStreamGetView(&stream), "% ", floats[i]);
+        }
+    }));
+
+    report(ZCL_STR_LITERAL("Floats (9 significant digits), snprintf"), BenchMeasure([buf, floats]() {
+        zcl::t_i32 pos = 0;
+
+        for (zcl::t_i32 i = 0; i < floats.len; i++) {
+            pos += snprintf(buf.raw + pos, static_cast<size_t>(buf.len - pos), "%.9g ", static_cast<zcl::t_f64>(floats[i]));
+        }
+    }));
+}
+
+// Measures how long a logging call takes on the calling thread, which is all the hot path sees. Rings are flushed between batches (outside of the timing) so that records never get dropped, since dropping is cheaper than submitting.
+static void BenchLoggerSubmit(const t_bench_context &context) {
+    constexpr zcl::t_i32 k_batch_record_cnt = 4096;
+
+    zcl::t_logger_config config = zcl::LoggerConfigCreate();
+    config.console = false;
+    config.thread_ring_cap = k_batch_record_cnt;
+
+    zcl::t_logger *logger;
+    ZCL_REQUIRE(zcl::LoggerCreate(config, context.perm_arena, &logger));
+    ZCL_DEFER({ zcl::LoggerDestroy(logger); });
+
+    // Gives the average seconds per record submitted by the calling thread.
+    const auto measure = [logger](const zcl::t_log_level level) {
+        zcl::t_f64 secs_total = 0.0;
+        zcl::t_i32 record_cnt = 0;
+
+        while (secs_total < k_bench_duration_min) {
+            const zcl::t_f64 time_begin = GetTimeNow();
+
+            for (zcl::t_i32 i = 0; i < k_batch_record_cnt; i++) {
+                zcl::LoggerWrite(logger, level, zcl::k_log_category_default, "Record % of batch, value %", i, 3.14159f);
+            }
+
+            secs_total += GetTimeNow() - time_begin;
+            record_cnt += k_batch_record_cnt;
+
+            zcl::LoggerFlush(logger);
+        }
+
+        return secs_total / static_cast<zcl::t_f64>(record_cnt);
+    };
+
+    const auto report = [](const zcl::t_str_rdonly title, const zcl::t_f64 secs_per_record) {
+        zcl::Log("    % - % ns per record", title, zcl::FormatFloat(secs_per_record * 1000000000.0, 2));
+    };
+
+    report(ZCL_STR_LITERAL("1 thread"), measure(zcl::ek_log_level_info));
+    report(ZCL_STR_LITERAL("1 thread, filtered out by level"), measure(zcl::ek_log_level_debug));
+
+    constexpr zcl::t_i32 k_thread_cnt = 4;
+
+    zcl::t_worker_pool *const pool = zcl::WorkerPoolCreate(k_thread_cnt - 1, context.perm_arena);
+    ZCL_DEFER({ zcl::WorkerPoolDestroy(pool); });
+
+    zcl::t_static_array<zcl::t_f64, k_thread_cnt> thread_secs_per_record;
+
+    zcl::WorkerPoolRun(pool, k_thread_cnt, [&measure, &thread_secs_per_record](const zcl::t_i32 task_index) {
+        thread_secs_per_record[task_index] = measure(zcl::ek_log_level_info);
+    });
+
+    zcl::t_f64 secs_per_record_sum = 0.0;
+
+    for (zcl::t_i32 i = 0; i < k_thread_cnt; i++) {
+        secs_per_record_sum += thread_secs_per_record[i];
+    }
+
+    report(ZCL_STR_LITERAL("4 threads at once, average per thread"), secs_per_record_sum / k_thread_cnt);
+}
+
+struct t_bench {
+    zcl::t_str_rdonly title;
+    void (*func)(const t_bench_context &context);
+};
+
+static const zcl::t_static_array<t_bench, 10> g_benches = {{
+    {.title = ZCL_STR_LITERAL("CalcStrRenderInfo"), .func = BenchCalcStrRenderInfo},
+    {.title = ZCL_STR_LITERAL("CalcStrRenderInfoShaped"), .func = BenchCalcStrRenderInfoShaped},
+    {.title = ZCL_STR_LITERAL("Text Layout"), .func = BenchTextLayout},
+    {.title = ZCL_STR_LITERAL("RendererSubmitStr"), .func = BenchRendererSubmitStr},
+    {.title = ZCL_STR_LITERAL("Font Loading"), .func = BenchFontLoad},
+    {.title = ZCL_STR_LITERAL("Sorting"), .func = BenchSorting},
+    {.title = ZCL_STR_LITERAL("Parallel Algorithms"), .func = BenchParallelAlgos},
+    {.title = ZCL_STR_LITERAL("Concurrent Rings"), .func = BenchRings},
+    {.title = ZCL_STR_LITERAL("Number Printing"), .func = BenchPrintNumbers},
+    {.title = ZCL_STR_LITERAL("Logger Submission"), .func = BenchLoggerSubmit},
+}};
+
+// ==================================================
+
+static void RunBenches(const zcl::t_str_rdonly font_file_path) {
+    zcl::t_arena *const perm_arena = zcl::ArenaCreateBlockBased();
+    ZCL_DEFER({ zcl::ArenaDestroy(perm_arena); });
+
+    zcl::t_arena *const temp_arena = zcl::ArenaCreateBlockBased();
+    ZCL_DEFER({ zcl::ArenaDestroy(temp_arena); });
+
+    // Fixed seed so that runs are comparable.
+    zcl::t_rng *const rng = zcl::RNGCreate(0, perm_arena);
+
+    const zgl::t_gfx_ticket_mut gfx_ticket = zgl::internal::GFXStartupHeadless(k_backbuffer_size);
+    ZCL_DEFER({ zgl::internal::GFXShutdown(gfx_ticket); });
+
+    zgl::t_rendering_basis *const rendering_basis = zgl::internal::RenderingBasisCreate(k_frame_vertex_limit, gfx_ticket, perm_arena, temp_arena);
+    ZCL_DEFER({ zgl::internal::RenderingBasisDestroy(rendering_basis, gfx_ticket); });
+
+    zgl::t_gfx_resource_group *const resource_group = zgl::GFXResourceGroupCreate(gfx_ticket, perm_arena);
+    ZCL_DEFER({ zgl::GFXResourceGroupDestroy(gfx_ticket, resource_group); });
+
+    // All synthetic fonts share a single blank atlas.
+    const auto atlas_textures = zcl::ArenaPushArray<zgl::t_gfx_resource *>(perm_arena, 1);
+
+    {
+        const auto atlas_pixels = zcl::ArenaPushArray<zcl::t_color_r8>(temp_arena, zcl::k_font_atlas_texture_size.x * zcl::k_font_atlas_texture_size.y);
+
+        const zcl::t_texture_data_rdonly atlas_texture_data = {
+            .dims = zcl::k_font_atlas_texture_size,
+            .format = zcl::ek_texture_format_r8,
+            .pixels = {.r8 = atlas_pixels},
+        };
+
+        atlas_textures[0] = zgl::TextureCreate(gfx_ticket, atlas_texture_data, resource_group);
+    }
+
+    zcl::ArenaRewind(temp_arena);
+
+    const t_bench_context context = {
+        .perm_arena = perm_arena,
+        .temp_arena = temp_arena,
+        .rng = rng,
+        .gfx_ticket = gfx_ticket,
+        .rendering_basis = rendering_basis,
+        .atlas_textures = atlas_textures,
+        .font_file_path = font_file_path,
+    };
+
+    for (zcl::t_i32 i = 0; i < g_benches.k_len; i++) {
+        zcl::Log("Running benchmark \"%\"...", g_benches[i].title);
+        g_benches[i].func(context);
+        zcl::ArenaRewind(temp_arena);
+    }
+
+    zcl::Log("All benchmarks completed!");
+}
+
+// Optionally takes the path of a TrueType font file to benchmark font loading with.
+int main(const int arg_cnt, const char *const *const args) {
+    RunBenches(arg_cnt > 1 ? zcl::CStrToStr(args[1]) : zcl::t_str_rdonly{});
+}
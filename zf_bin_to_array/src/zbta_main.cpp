@@ -20,17 +20,20 @@
 
     ZCL_DEFER({ zcl::FileClose(&output_file_stream); });
 
+    // Every input byte produces a handful of tiny writes, so collect them up.
+    zcl::FileStreamSetWriteBuffer(&output_file_stream, zcl::ArenaPushArray<zcl::t_u8>(arena, 1 << 16));
+
     zcl::Print(zcl::FileStreamGetView(&output_file_stream), ZCL_STR_LITERAL("#include <zcl/zcl_basic.h>\n"));
     zcl::Print(zcl::FileStreamGetView(&output_file_stream), ZCL_STR_LITERAL("\n"));
 
     zcl::t_str_rdonly indent = {};
 
     if (!zcl::StrCheckEmpty(namespace_name)) {
-        zcl::PrintFormat(zcl::FileStreamGetView(&output_file_stream), ZCL_STR_LITERAL("namespace % {\n"), namespace_name);
+        zcl::PrintFormat(zcl::FileStreamGetView(&output_file_stream), "namespace % {\n", namespace_name);
         indent = ZCL_STR_LITERAL("    ");
     }
 
-    zcl::PrintFormat(zcl::FileStreamGetView(&output_file_stream), ZCL_STR_LITERAL("%extern const zcl::t_u8 g_%_raw[] = {"), indent, arr_var_subname);
+    zcl::PrintFormat(zcl::FileStreamGetView(&output_file_stream), "%extern const zcl::t_u8 g_%_raw[] = {", indent, arr_var_subname);
 
     zcl::t_u8 byte_read;
     zcl::t_i32 byte_read_cnt = 0;
@@ -40,26 +43,30 @@
             zcl::Print(zcl::FileStreamGetView(&output_file_stream), ZCL_STR_LITERAL(", "));
         }
 
-        zcl::PrintFormat(zcl::FileStreamGetView(&output_file_stream), ZCL_STR_LITERAL("%"), zcl::FormatHex(byte_read));
+        zcl::PrintFormat(zcl::FileStreamGetView(&output_file_stream), "%", zcl::FormatHex(byte_read));
 
         byte_read_cnt++;
     }
 
     zcl::Print(zcl::FileStreamGetView(&output_file_stream), ZCL_STR_LITERAL("};\n"));
 
-    zcl::PrintFormat(zcl::FileStreamGetView(&output_file_stream), ZCL_STR_LITERAL("%extern const zcl::t_i32 g_%_len = %;\n"), indent, arr_var_subname, byte_read_cnt);
+    zcl::PrintFormat(zcl::FileStreamGetView(&output_file_stream), "%extern const zcl::t_i32 g_%_len = %;\n", indent, arr_var_subname, byte_read_cnt);
 
     if (!zcl::StrCheckEmpty(namespace_name)) {
         zcl::Print(zcl::FileStreamGetView(&output_file_stream), ZCL_STR_LITERAL("}\n"));
     }
 
+    if (!zcl::FileStreamFlushWriteBuffer(&output_file_stream)) {
+        return false;
+    }
+
     return true;
 }
 
 int main(const int arg_cnt, const char *const *const args) {
     if (arg_cnt != 5) {
         zcl::t_file_stream std_err = zcl::FileStreamCreateStdError();
-        zcl::PrintFormat(zcl::FileStreamGetView(&std_err), ZCL_STR_LITERAL("Invalid command-line argument count!\nUsage: zf_bin_to_array <input_file_path> <output_file_path> <array_variable_subname> <namespace>\nNote that the given namespace can be empty for no namespace.\n"));
+        zcl::PrintFormat(zcl::FileStreamGetView(&std_err), "Invalid command-line argument count!\nUsage: zf_bin_to_array <input_file_path> <output_file_path> <array_variable_subname> <namespace>\nNote that the given namespace can be empty for no namespace.\n");
         return 1;
     }
 
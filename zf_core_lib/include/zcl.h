@@ -5,12 +5,17 @@
 #include <zcl/zcl_math.h>
 #include <zcl/zcl_lists.h>
 #include <zcl/zcl_hash_maps.h>
+#include <zcl/zcl_slot_maps.h>
 #include <zcl/zcl_strs.h>
 #include <zcl/zcl_streams.h>
 #include <zcl/zcl_serialization.h>
 #include <zcl/zcl_file_sys.h>
+#include <zcl/zcl_file_loading.h>
 #include <zcl/zcl_printing.h>
+#include <zcl/zcl_logging.h>
 #include <zcl/zcl_gfx.h>
 #include <zcl/zcl_audio.h>
 #include <zcl/zcl_algos.h>
 #include <zcl/zcl_rand.h>
+#include <zcl/zcl_parallel.h>
+#include <zcl/zcl_rings.h>
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <bit>
 #include <zcl/zcl_basic.h>
 
 namespace zcl {
@@ -109,24 +110,6 @@ namespace zcl {
         return false;
     }
 
-    template <c_array tp_arr_type>
-    t_b8 RunBinarySearch(const tp_arr_type arr, const typename tp_arr_type::t_elem &elem, const t_comparator_ord<typename tp_arr_type::t_elem> comparator = k_comparator_ord_default<typename tp_arr_type::t_elem>) {
-        if (arr.len == 0) {
-            return false;
-        }
-
-        const auto &mid = arr[arr.len / 2];
-        const auto comparison_result = comparator(elem, mid);
-
-        if (comparison_result == 0) {
-            return true;
-        } else if (comparison_result < 0) {
-            return RunBinarySearch(ArraySlice(arr, 0, arr.len / 2), elem);
-        } else {
-            return RunBinarySearch(ArraySliceFrom(arr, (arr.len / 2) + 1), elem);
-        }
-    }
-
     template <c_array tp_arr_type>
     t_b8 CheckSorted(const tp_arr_type arr, const t_comparator_ord<typename tp_arr_type::t_elem> comparator = k_comparator_ord_default<typename tp_arr_type::t_elem>) {
         for (t_i32 i = 0; i < arr.len - 1; i++) {
@@ -155,9 +138,23 @@ namespace zcl {
         } while (!sorted);
     }
 
-    // O(n) best-case if array is already sorted, O(n^2) worst-case.
-    template <c_array tp_arr_type>
-    void RunInsertionSort(const tp_arr_type arr, const t_comparator_ord<typename tp_arr_type::t_elem> comparator = k_comparator_ord_default<typename tp_arr_type::t_elem>) {
+    namespace internal {
+        // Lets sorts that take their comparator as a template parameter call the default comparator directly, so it can be inlined.
+        template <c_simple tp_type>
+        struct t_comparator_ord_default_functor {
+            constexpr t_i32 operator()(const tp_type &a, const tp_type &b) const {
+                return k_comparator_ord_default<tp_type>(a, b);
+            }
+        };
+
+        // Subarrays of this length or less get insertion sorted by the divide-and-conquer sorts, since it's faster at that size.
+        constexpr t_i32 k_sort_insertion_threshold = 16;
+    }
+
+    // O(n) best-case if array is already sorted, O(n^2) worst-case. Stable.
+    // The comparator can be a function pointer or any functor with the same signature - the latter lets it be inlined.
+    template <c_array_mut tp_arr_type, typename tp_comparator_type = internal::t_comparator_ord_default_functor<typename tp_arr_type::t_elem>>
+    void RunInsertionSort(const tp_arr_type arr, const tp_comparator_type &comparator = {}) {
         for (t_i32 i = 1; i < arr.len; i++) {
             const auto temp = arr[i];
 
@@ -191,109 +188,406 @@ namespace zcl {
         }
     }
 
-    // O(n log n) in both time complexity and space complexity in every case.
-    template <typename tp_arr_type>
-    void RunMergeSort(const tp_arr_type arr, t_arena *const temp_arena, const t_comparator_ord<typename tp_arr_type::t_elem> comparator = k_comparator_ord_default<typename tp_arr_type::t_elem>) {
+    namespace internal {
+        template <c_array_mut tp_arr_type, typename tp_comparator_type>
+        void RunMergeSortStep(const tp_arr_type arr, const tp_arr_type scratch, const tp_comparator_type &comparator) {
+            if (arr.len <= k_sort_insertion_threshold) {
+                RunInsertionSort(arr, comparator);
+                return;
+            }
+
+            const t_i32 mid = arr.len / 2;
+
+            RunMergeSortStep(ArraySlice(arr, 0, mid), ArraySlice(scratch, 0, mid), comparator);
+            RunMergeSortStep(ArraySliceFrom(arr, mid), ArraySliceFrom(scratch, mid), comparator);
+
+            if (comparator(arr[mid - 1], arr[mid]) <= 0) {
+                return; // The halves are already in order.
+            }
+
+            // Move the left half out of the way, then merge both halves into place. Only the left half needs to be moved since the write position can never overtake the right read position.
+            const auto left = ArraySlice(scratch, 0, mid);
+            ArrayCopy(ArraySlice(arr, 0, mid), left);
+
+            t_i32 i = 0;
+            t_i32 j = mid;
+            t_i32 k = 0;
+
+            while (i < left.len && j < arr.len) {
+                // Taking from the left on ties is what keeps this stable.
+                if (comparator(arr[j], left[i]) < 0) {
+                    arr[k] = arr[j];
+                    j++;
+                } else {
+                    arr[k] = left[i];
+                    i++;
+                }
+
+                k++;
+            }
+
+            ArrayCopy(ArraySliceFrom(left, i), ArraySliceFrom(arr, k));
+        }
+    }
+
+    // O(n log n) time complexity in every case, and O(n) space complexity for a single scratch buffer allocated upfront. Stable.
+    template <c_array_mut tp_arr_type, typename tp_comparator_type = internal::t_comparator_ord_default_functor<typename tp_arr_type::t_elem>>
+    void RunMergeSort(const tp_arr_type arr, t_arena *const temp_arena, const tp_comparator_type &comparator = {}) {
         if (arr.len <= 1) {
             return;
         }
 
-        // Sort copies of the left and right partitions.
-        const auto arr_left_sorted = ArenaPushArrayClone(temp_arena, ArraySlice(arr, 0, arr.len / 2));
-        RunMergeSort(arr_left_sorted, temp_arena, comparator);
+        const auto scratch = ArenaPushArray<typename tp_arr_type::t_elem>(temp_arena, arr.len);
+        internal::RunMergeSortStep(arr, scratch, comparator);
+    }
 
-        const auto arr_right_sorted = ArenaPushArrayClone(temp_arena, ArraySliceFrom(arr, arr.len / 2));
-        RunMergeSort(arr_right_sorted, temp_arena, comparator);
+    // O(n log n) time complexity in every case, and O(1) space complexity. Not stable.
+    template <c_array_mut tp_arr_type, typename tp_comparator_type = internal::t_comparator_ord_default_functor<typename tp_arr_type::t_elem>>
+    void RunHeapSort(const tp_arr_type arr, const tp_comparator_type &comparator = {}) {
+        // Moves the element at the given index down the max-heap in [0, heap_len) until it's no less than either of its children.
+        const auto sift_down = [arr, &comparator](t_i32 index, const t_i32 heap_len) {
+            while (true) {
+                t_i32 child_index = (2 * index) + 1;
 
-        // Update this array.
-        t_i32 i = 0;
-        t_i32 j = 0;
+                if (child_index >= heap_len) {
+                    break;
+                }
 
-        do {
-            if (comparator(arr_left_sorted[i], arr_right_sorted[j]) <= 0) {
-                arr[i + j] = arr_left_sorted[i];
-                i++;
+                if (child_index + 1 < heap_len && comparator(arr[child_index], arr[child_index + 1]) < 0) {
+                    child_index++;
+                }
 
-                if (i == arr_left_sorted.len) {
-                    // Copy over the remainder of the right array.
-                    ArrayCopy(ArraySliceFrom(arr_right_sorted, j), ArraySliceFrom(arr, i + j));
+                if (comparator(arr[index], arr[child_index]) >= 0) {
                     break;
                 }
-            } else {
-                arr[i + j] = arr_right_sorted[j];
-                j++;
 
-                if (j == arr_right_sorted.len) {
-                    // Copy over the remainder of the left array.
-                    ArrayCopy(ArraySliceFrom(arr_left_sorted, i), ArraySliceFrom(arr, i + j));
-                    break;
+                Swap(&arr[index], &arr[child_index]);
+                index = child_index;
+            }
+        };
+
+        for (t_i32 i = (arr.len / 2) - 1; i >= 0; i--) {
+            sift_down(i, arr.len);
+        }
+
+        for (t_i32 i = arr.len - 1; i > 0; i--) {
+            Swap(&arr[0], &arr[i]);
+            sift_down(0, i);
+        }
+    }
+
+    namespace internal {
+        template <c_array_mut tp_arr_type, typename tp_comparator_type>
+        void RunQuickSortStep(tp_arr_type arr, t_i32 depth_limit, const tp_comparator_type &comparator) {
+            while (arr.len > k_sort_insertion_threshold) {
+                if (depth_limit == 0) {
+                    // Partitioning is going badly, so fall back to something with a guaranteed bound.
+                    RunHeapSort(arr, comparator);
+                    return;
+                }
+
+                depth_limit--;
+
+                // Put the median of the first, middle, and last elements in the middle to use as the pivot.
+                {
+                    const t_i32 ia = 0;
+                    const t_i32 ib = arr.len / 2;
+                    const t_i32 ic = arr.len - 1;
+
+                    if (comparator(arr[ib], arr[ia]) < 0) {
+                        Swap(&arr[ib], &arr[ia]);
+                    }
+
+                    if (comparator(arr[ic], arr[ib]) < 0) {
+                        Swap(&arr[ic], &arr[ib]);
+
+                        if (comparator(arr[ib], arr[ia]) < 0) {
+                            Swap(&arr[ib], &arr[ia]);
+                        }
+                    }
+                }
+
+                const auto pivot = arr[arr.len / 2];
+
+                // Hoare partitioning. Scans stop on elements equal to the pivot, which keeps the split balanced when there are lots of duplicates.
+                t_i32 i = -1;
+                t_i32 j = arr.len;
+
+                while (true) {
+                    do {
+                        i++;
+                    } while (comparator(arr[i], pivot) < 0);
+
+                    do {
+                        j--;
+                    } while (comparator(pivot, arr[j]) < 0);
+
+                    if (i >= j) {
+                        break;
+                    }
+
+                    Swap(&arr[i], &arr[j]);
+                }
+
+                // Recurse into the smaller side and loop on the larger one, so the stack depth stays logarithmic.
+                const auto left = ArraySlice(arr, 0, j + 1);
+                const auto right = ArraySliceFrom(arr, j + 1);
+
+                if (left.len < right.len) {
+                    RunQuickSortStep(left, depth_limit, comparator);
+                    arr = right;
+                } else {
+                    RunQuickSortStep(right, depth_limit, comparator);
+                    arr = left;
                 }
             }
-        } while (true);
+
+            RunInsertionSort(arr, comparator);
+        }
     }
 
-    // Time complexity is O(n log n) best-case and O(n^2) worst-case depending on the pivot.
-    // Space complexity is O(1) compared to merge sort.
-    // In each recurse, the pivot is selected as the median of the first, middle, and last elements.
-    template <c_array tp_arr_type>
-    void RunQuickSort(const tp_arr_type arr, const t_comparator_ord<typename tp_arr_type::t_elem> comparator = k_comparator_ord_default<typename tp_arr_type::t_elem>) {
+    // Introsort - quicksort with a median-of-three pivot, which switches to insertion sort for small subarrays and to heap sort if the recursion gets too deep.
+    // O(n log n) time complexity in every case, and O(log n) space complexity (stack). Not stable.
+    template <c_array_mut tp_arr_type, typename tp_comparator_type = internal::t_comparator_ord_default_functor<typename tp_arr_type::t_elem>>
+    void RunQuickSort(const tp_arr_type arr, const tp_comparator_type &comparator = {}) {
         if (arr.len <= 1) {
             return;
         }
 
-        if (arr.len == 2) {
-            if (comparator(arr[0], arr[1]) > 0) {
-                Swap(&arr[0], &arr[1]);
-            }
+        t_i32 depth_limit = 0;
 
-            return;
+        for (t_i32 len = arr.len; len > 1; len /= 2) {
+            depth_limit += 2;
         }
 
-        // Determine the pivot - median of the first, middle, and last elements.
-        const t_i32 pivot_index = [arr, comparator]() {
-            const t_i32 ia = 0;
-            const t_i32 ib = arr.len / 2;
-            const t_i32 ic = arr.len - 1;
+        internal::RunQuickSortStep(arr, depth_limit, comparator);
+    }
 
-            if (comparator(arr[ia], arr[ib]) <= 0) {
-                if (comparator(arr[ib], arr[ic]) <= 0) {
-                    return ib;
-                } else {
-                    if (comparator(arr[ia], arr[ic]) <= 0) {
-                        return ic;
-                    } else {
-                        return ia;
-                    }
-                }
+    namespace internal {
+        // Maps a numeric key to an unsigned integer of the same size, such that comparing the results as unsigned integers gives the same order as comparing the keys.
+        template <c_numeric tp_key_type>
+        constexpr auto RadixSortKeyToBits(const tp_key_type key) {
+            if constexpr (c_integral_unsigned<tp_key_type>) {
+                return key;
+            } else if constexpr (c_integral_signed<tp_key_type>) {
+                // Flipping the sign bit moves negatives below positives.
+                using t_bits = std::make_unsigned_t<tp_key_type>;
+                return static_cast<t_bits>(static_cast<t_bits>(key) ^ (static_cast<t_bits>(1) << ((ZCL_SIZE_OF(t_bits) * 8) - 1)));
             } else {
-                if (comparator(arr[ia], arr[ic]) <= 0) {
-                    return ia;
-                } else {
-                    if (comparator(arr[ib], arr[ic]) <= 0) {
-                        return ic;
-                    } else {
-                        return ib;
-                    }
-                }
+                // Positives just need the sign bit set to move them above negatives, while negatives need all bits flipped since a greater magnitude means a lesser value.
+                using t_bits = std::conditional_t<ZCL_SIZE_OF(tp_key_type) == 4, t_u32, t_u64>;
+                static_assert(ZCL_SIZE_OF(t_bits) == ZCL_SIZE_OF(tp_key_type));
+
+                const auto bits = std::bit_cast<t_bits>(key);
+                const t_bits sign_bit = static_cast<t_bits>(1) << ((ZCL_SIZE_OF(t_bits) * 8) - 1);
+
+                return (bits & sign_bit) ? static_cast<t_bits>(~bits) : static_cast<t_bits>(bits | sign_bit);
             }
-        }();
+        }
+    }
+
+    // LSD radix sort by a numeric key, which the given function extracts from each element. The key function is called exactly once per element, and no comparisons are made.
+    // O(n) time complexity and O(n) space complexity (allocated on the temporary arena). The sort is stable.
+    // Each pass handles one byte of the key, and passes in which every key has the same byte are skipped, so small keys in wide types are cheap.
+    // For float keys, -0 is ordered before +0, and NaNs are ordered by their bit patterns (i.e. they end up at the extremes).
+    template <c_array_mut tp_arr_type, typename tp_key_func_type>
+    void RunRadixSortByKey(const tp_arr_type arr, t_arena *const temp_arena, const tp_key_func_type &key_func) {
+        using t_elem = typename tp_arr_type::t_elem;
+        using t_key = t_without_cvref<decltype(key_func(arr[0]))>;
+        static_assert(c_numeric<t_key>, "The key function must return a numeric type!");
+
+        using t_key_bits = decltype(internal::RadixSortKeyToBits(t_key()));
+        constexpr t_i32 k_pass_cnt = ZCL_SIZE_OF(t_key_bits);
+
+        if (arr.len <= 1) {
+            return;
+        }
 
-        // Swap it out to the end to get it out of the way.
-        Swap(&arr[pivot_index], &arr[arr.len - 1]);
+        const auto keys = ArenaPushArray<t_key_bits>(temp_arena, arr.len);
+        const auto keys_scratch = ArenaPushArray<t_key_bits>(temp_arena, arr.len);
+        const auto elems_scratch = ArenaPushArray<t_elem>(temp_arena, arr.len);
 
-        // Move smaller elements to the left, and decide the final pivot position.
-        t_i32 left_sec_last_index = -1;
+        // Extract the keys and build the histograms for every pass in one go.
+        t_static_array<t_static_array<t_i32, 256>, k_pass_cnt> counts = {};
 
         for (t_i32 i = 0; i < arr.len; i++) {
-            if (comparator(arr[i], arr[arr.len - 1]) <= 0) {
-                // This element is not greater than the pivot, so swap it to the left section.
-                left_sec_last_index++;
-                Swap(&arr[left_sec_last_index], &arr[i]);
+            keys[i] = internal::RadixSortKeyToBits(key_func(arr[i]));
+
+            for (t_i32 pass = 0; pass < k_pass_cnt; pass++) {
+                counts[pass][static_cast<t_u8>(keys[i] >> (pass * 8))]++;
+            }
+        }
+
+        t_array_mut<t_elem> elems_src = {arr.raw, arr.len};
+        t_array_mut<t_elem> elems_dest = elems_scratch;
+        t_array_mut<t_key_bits> keys_src = keys;
+        t_array_mut<t_key_bits> keys_dest = keys_scratch;
+
+        for (t_i32 pass = 0; pass < k_pass_cnt; pass++) {
+            auto &pass_counts = counts[pass];
+
+            if (pass_counts[static_cast<t_u8>(keys_src[0] >> (pass * 8))] == arr.len) {
+                continue;
+            }
+
+            // Turn the counts into the destination offset of each bucket.
+            t_i32 offs = 0;
+
+            for (t_i32 i = 0; i < pass_counts.k_len; i++) {
+                const t_i32 cnt = pass_counts[i];
+                pass_counts[i] = offs;
+                offs += cnt;
+            }
+
+            for (t_i32 i = 0; i < arr.len; i++) {
+                t_i32 &dest_index = pass_counts[static_cast<t_u8>(keys_src[i] >> (pass * 8))];
+
+                elems_dest[dest_index] = elems_src[i];
+                keys_dest[dest_index] = keys_src[i];
+
+                dest_index++;
+            }
+
+            Swap(&elems_src, &elems_dest);
+            Swap(&keys_src, &keys_dest);
+        }
+
+        if (elems_src.raw != arr.raw) {
+            ArrayCopy(elems_src, elems_dest);
+        }
+    }
+
+    // LSD radix sort of integers or floats. See RunRadixSortByKey for details.
+    template <c_array_mut tp_arr_type>
+        requires c_numeric<typename tp_arr_type::t_elem>
+    void RunRadixSort(const tp_arr_type arr, t_arena *const temp_arena) {
+        RunRadixSortByKey(arr, temp_arena, [](const typename tp_arr_type::t_elem &elem) { return elem; });
+    }
+
+    // Sorting these instead of the items themselves means less data gets moved around per pass, which pays off for large items. The sorted indexes then give the order in which to visit the items.
+    template <c_numeric tp_key_type>
+    struct t_key_index_pair {
+        tp_key_type key;
+        t_i32 index;
+    };
+
+    // Stable LSD radix sort of key-index pairs by key. See RunRadixSortByKey for details.
+    template <c_numeric tp_key_type>
+    void RunRadixSort(const t_array_mut<t_key_index_pair<tp_key_type>> pairs, t_arena *const temp_arena) {
+        RunRadixSortByKey(pairs, temp_arena, [](const t_key_index_pair<tp_key_type> &pair) { return pair.key; });
+    }
+
+    // The binary searches below all expect the array to be sorted with respect to the comparator. They're iterative, and the loop body picks the next half with a conditional move rather than a branch, so they don't suffer from branch mispredictions.
+
+    // Returns the index of the first element not less than the given one, or the array length if there's no such element.
+    template <c_array tp_arr_type, typename tp_comparator_type = internal::t_comparator_ord_default_functor<typename tp_arr_type::t_elem>>
+    t_i32 BinarySearchLowerBound(const tp_arr_type arr, const typename tp_arr_type::t_elem &elem, const tp_comparator_type &comparator = {}) {
+        if (arr.len == 0) {
+            return 0;
+        }
+
+        t_i32 base = 0;
+        t_i32 len = arr.len;
+
+        while (len > 1) {
+            const t_i32 half = len / 2;
+            base = comparator(arr[base + half], elem) < 0 ? base + half : base;
+            len -= half;
+        }
+
+        return base + (comparator(arr[base], elem) < 0 ? 1 : 0);
+    }
+
+    // Returns the index of the first element greater than the given one, or the array length if there's no such element.
+    template <c_array tp_arr_type, typename tp_comparator_type = internal::t_comparator_ord_default_functor<typename tp_arr_type::t_elem>>
+    t_i32 BinarySearchUpperBound(const tp_arr_type arr, const typename tp_arr_type::t_elem &elem, const tp_comparator_type &comparator = {}) {
+        if (arr.len == 0) {
+            return 0;
+        }
+
+        t_i32 base = 0;
+        t_i32 len = arr.len;
+
+        while (len > 1) {
+            const t_i32 half = len / 2;
+            base = comparator(arr[base + half], elem) <= 0 ? base + half : base;
+            len -= half;
+        }
+
+        return base + (comparator(arr[base], elem) <= 0 ? 1 : 0);
+    }
+
+    // Gives the index range [begin, end) of all elements equal to the given one. The range is empty if there are none.
+    template <c_array tp_arr_type, typename tp_comparator_type = internal::t_comparator_ord_default_functor<typename tp_arr_type::t_elem>>
+    void BinarySearchEqualRange(const tp_arr_type arr, const typename tp_arr_type::t_elem &elem, t_i32 *const o_begin, t_i32 *const o_end, const tp_comparator_type &comparator = {}) {
+        *o_begin = BinarySearchLowerBound(arr, elem, comparator);
+        *o_end = *o_begin + BinarySearchUpperBound(ArraySliceFrom(arr, *o_begin), elem, comparator);
+    }
+
+    // Returns true iff an element equal to the given one exists.
+    template <c_array tp_arr_type, typename tp_comparator_type = internal::t_comparator_ord_default_functor<typename tp_arr_type::t_elem>>
+    t_b8 RunBinarySearch(const tp_arr_type arr, const typename tp_arr_type::t_elem &elem, const tp_comparator_type &comparator = {}) {
+        const t_i32 index = BinarySearchLowerBound(arr, elem, comparator);
+        return index < arr.len && comparator(arr[index], elem) == 0;
+    }
+
+    // ============================================================
+    // @section: Eytzinger Layouts
+
+    // An Eytzinger layout stores a sorted array in breadth-first order of its implicit binary search tree: the root at index 1, and the children of index k at indexes 2k and 2k + 1. Index 0 is unused.
+    // The elements a search visits are then close together near the top of the tree, which makes searches of large read-mostly tables far more cache-friendly than a regular binary search.
+    // To look up associated data, lay out key-value structs and give a comparator which only looks at the key.
+
+    namespace internal {
+        template <c_array tp_src_arr_type, c_array_mut tp_dest_arr_type>
+        void EytzingerLayoutFill(const tp_src_arr_type sorted_arr, const tp_dest_arr_type layout, t_i32 *const sorted_index, const t_i32 layout_index) {
+            if (layout_index >= layout.len) {
+                return;
             }
+
+            EytzingerLayoutFill(sorted_arr, layout, sorted_index, 2 * layout_index);
+
+            layout[layout_index] = sorted_arr[*sorted_index];
+            (*sorted_index)++;
+
+            EytzingerLayoutFill(sorted_arr, layout, sorted_index, (2 * layout_index) + 1);
         }
+    }
 
-        // Sort for each subsection.
-        RunQuickSort(ArraySlice(arr, 0, left_sec_last_index), comparator);
-        RunQuickSort(ArraySliceFrom(arr, left_sec_last_index + 1), comparator);
+    // The array must be sorted. The returned layout has a length of one more than the array.
+    template <c_array tp_arr_type>
+    t_array_mut<typename tp_arr_type::t_elem> EytzingerLayoutCreate(const tp_arr_type sorted_arr, t_arena *const arena) {
+        const auto result = ArenaPushArray<typename tp_arr_type::t_elem>(arena, sorted_arr.len + 1);
+
+        t_i32 sorted_index = 0;
+        internal::EytzingerLayoutFill(sorted_arr, result, &sorted_index, 1);
+
+        return result;
     }
+
+    // Returns the layout index of the first element (in sorted order) not less than the given one, or -1 if there's no such element.
+    template <c_array tp_arr_type, typename tp_comparator_type = internal::t_comparator_ord_default_functor<typename tp_arr_type::t_elem>>
+    t_i32 EytzingerSearchLowerBound(const tp_arr_type layout, const typename tp_arr_type::t_elem &elem, const tp_comparator_type &comparator = {}) {
+        ZCL_ASSERT(layout.len >= 1);
+
+        t_u32 k = 1;
+
+        while (k < static_cast<t_u32>(layout.len)) {
+            k = (2 * k) + (comparator(layout[static_cast<t_i32>(k)], elem) < 0 ? 1 : 0);
+        }
+
+        // The path went right after every element that was less and left after every one that wasn't, so undoing the trailing right turns (and then one more) lands on the last element that wasn't less.
+        k >>= std::countr_one(k) + 1;
+
+        return k == 0 ? -1 : static_cast<t_i32>(k);
+    }
+
+    // Returns the layout index of an element equal to the given one, or -1 if there is none.
+    template <c_array tp_arr_type, typename tp_comparator_type = internal::t_comparator_ord_default_functor<typename tp_arr_type::t_elem>>
+    t_i32 EytzingerSearch(const tp_arr_type layout, const typename tp_arr_type::t_elem &elem, const tp_comparator_type &comparator = {}) {
+        const t_i32 index = EytzingerSearchLowerBound(layout, elem, comparator);
+        return index != -1 && comparator(layout[index], elem) == 0 ? index : -1;
+    }
+
+    // ==================================================
 }
@@ -147,6 +147,10 @@ namespace zcl {
     template <typename tp_type>
     using t_without_cvref = typename std::remove_cvref<tp_type>::type;
 
+    // Wrapping a parameter type in this stops template arguments from being deduced through that parameter.
+    template <typename tp_type>
+    using t_nondeduced = typename std::type_identity<tp_type>::type;
+
     // "Simple" meaning that it's safe to use with arenas and C-style memory operations.
     template <typename tp_type>
     concept c_simple = std::is_trivially_default_constructible_v<tp_type> && std::is_trivially_destructible_v<tp_type> && std::is_trivially_copyable_v<tp_type> && std::is_standard_layout_v<tp_type>;
@@ -629,6 +633,9 @@ namespace zcl {
         return {static_cast<tp_elem_type *>(ArenaPushRaw(arena, size, ZCL_ALIGN_OF(tp_elem_type))), len};
     }
 
+    // Tries to grow the given allocation in place to the new size, which only works if it was the most recent allocation and there's room left after it. Returns true iff it succeeded, in which case the added bytes are zeroed.
+    [[nodiscard]] t_b8 ArenaTryExtend(t_arena *const arena, void *const buf, const t_i32 size, const t_i32 size_new);
+
     template <c_array tp_arr_type>
     auto ArenaPushArrayClone(t_arena *const arena, const tp_arr_type arr_to_clone) {
         const auto arr = ArenaPushArray<typename tp_arr_type::t_elem>(arena, arr_to_clone.len);
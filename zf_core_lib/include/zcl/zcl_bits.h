@@ -92,6 +92,14 @@ namespace zcl {
         return {bs.bytes_raw, BitsToBytes(bs.bit_cnt)};
     }
 
+    // Bitset operations internally work on words of this many bits.
+    constexpr t_i32 k_bitset_word_bit_cnt = 64;
+
+    constexpr t_i32 BitsetGetWordCount(const t_i32 bit_cnt) {
+        ZCL_ASSERT(bit_cnt >= 0);
+        return (bit_cnt + k_bitset_word_bit_cnt - 1) / k_bitset_word_bit_cnt;
+    }
+
     constexpr t_i32 BitsetGetLastByteBitCount(const t_i32 bit_cnt) {
         ZCL_ASSERT(bit_cnt >= 0);
         return ((bit_cnt - 1) % 8) + 1;
@@ -167,4 +175,133 @@ namespace zcl {
 
     // Returned indexes are guaranteed to be in ascending order.
     t_array_mut<t_i32> BitsetLoadIndexesOfSet(const t_bitset_rdonly bs, t_arena *const arena);
+
+    // Visits set bits in ascending order, one word of the bitset at a time, with no allocation. Cost is proportional to the number of words plus the number of set bits visited.
+    // Bits can be unset during the walk (e.g. the one just visited), but changes to the word currently being walked won't be picked up.
+    struct t_bitset_walker {
+        t_bitset_rdonly bs;
+
+        t_array_rdonly<t_bitset_rdonly> and_masks; // A bit is only visited if it is also set in all of these.
+        t_array_rdonly<t_bitset_rdonly> andnot_masks; // A bit is only visited if it is unset in all of these.
+
+        t_i32 word_index;
+        t_u64 word; // The remaining bits of the current word to visit.
+    };
+
+    // All masks must have the same bit count as the bitset being walked.
+    inline t_bitset_walker BitsetWalkerCreate(const t_bitset_rdonly bs, const t_array_rdonly<t_bitset_rdonly> and_masks = {}, const t_array_rdonly<t_bitset_rdonly> andnot_masks = {}) {
+        for (t_i32 i = 0; i < and_masks.len; i++) {
+            ZCL_ASSERT(and_masks[i].bit_cnt == bs.bit_cnt);
+        }
+
+        for (t_i32 i = 0; i < andnot_masks.len; i++) {
+            ZCL_ASSERT(andnot_masks[i].bit_cnt == bs.bit_cnt);
+        }
+
+        return {.bs = bs, .and_masks = and_masks, .andnot_masks = andnot_masks, .word_index = -1};
+    }
+
+    // Returns false iff the walk has ended.
+    t_b8 BitsetWalk(t_bitset_walker *const walker, t_i32 *const o_index);
+
+#define ZCL_BITSET_WALK_SET(bs, index)                                                                                                                                               \
+    for (zcl::t_bitset_walker ZCL_CONCAT(walker_l, __LINE__) = zcl::BitsetWalkerCreate(bs); ZCL_CONCAT(walker_l, __LINE__).word_index != -2; ZCL_CONCAT(walker_l, __LINE__).word_index = -2) \
+        for (zcl::t_i32 index; zcl::BitsetWalk(&ZCL_CONCAT(walker_l, __LINE__), &index);)
+
+    // ============================================================
+    // @section: Hierarchical Bitsets
+
+    // A bitset paired with a summary bitset in which each bit marks whether the corresponding word of the main bitset has any bits set.
+    // Searching, counting, walking and clearing skip over empty words via the summary, so large sparse sets are cheap to work with.
+    // The summary must be kept in sync, so only modify the main bitset through the functions below.
+
+    struct t_hierarchical_bitset_rdonly {
+        t_bitset_rdonly bits;
+        t_bitset_rdonly summary;
+    };
+
+    struct t_hierarchical_bitset_mut {
+        t_bitset_mut bits;
+        t_bitset_mut summary;
+
+        constexpr operator t_hierarchical_bitset_rdonly() const {
+            return {bits, summary};
+        }
+    };
+
+    template <t_i32 tp_bit_cnt>
+    struct t_static_hierarchical_bitset {
+        static constexpr t_i32 k_bit_cnt = tp_bit_cnt;
+
+        t_static_bitset<tp_bit_cnt> bits;
+        t_static_bitset<BitsetGetWordCount(tp_bit_cnt)> summary;
+
+        constexpr operator t_hierarchical_bitset_mut() {
+            return {bits, summary};
+        }
+
+        constexpr operator t_hierarchical_bitset_rdonly() const {
+            return {bits, summary};
+        }
+    };
+
+    inline t_hierarchical_bitset_mut HierarchicalBitsetCreate(const t_i32 bit_cnt, t_arena *const arena) {
+        return {BitsetCreate(bit_cnt, arena), BitsetCreate(BitsetGetWordCount(bit_cnt), arena)};
+    }
+
+    constexpr t_b8 HierarchicalBitsetCheckSet(const t_hierarchical_bitset_rdonly hbs, const t_i32 index) {
+        return BitsetCheckSet(hbs.bits, index);
+    }
+
+    constexpr void HierarchicalBitsetSet(const t_hierarchical_bitset_mut hbs, const t_i32 index) {
+        BitsetSet(hbs.bits, index);
+        BitsetSet(hbs.summary, index / k_bitset_word_bit_cnt);
+    }
+
+    void HierarchicalBitsetUnset(const t_hierarchical_bitset_mut hbs, const t_i32 index);
+
+    // Sets all bits in the range [begin_bit_index, end_bit_index).
+    inline void HierarchicalBitsetSetRange(const t_hierarchical_bitset_mut hbs, const t_i32 begin_bit_index, const t_i32 end_bit_index) {
+        BitsetSetRange(hbs.bits, begin_bit_index, end_bit_index);
+
+        if (begin_bit_index < end_bit_index) {
+            BitsetSetRange(hbs.summary, begin_bit_index / k_bitset_word_bit_cnt, ((end_bit_index - 1) / k_bitset_word_bit_cnt) + 1);
+        }
+    }
+
+    void HierarchicalBitsetUnsetAll(const t_hierarchical_bitset_mut hbs);
+
+    inline t_b8 HierarchicalBitsetCheckAnySet(const t_hierarchical_bitset_rdonly hbs) {
+        return BitsetCheckAnySet(hbs.summary);
+    }
+
+    // Returns the index of the found set bit, or -1 if all bits from the given index on are unset.
+    t_i32 HierarchicalBitsetFindFirstSet(const t_hierarchical_bitset_rdonly hbs, const t_i32 from = 0);
+
+    t_i32 HierarchicalBitsetCountSet(const t_hierarchical_bitset_rdonly hbs);
+
+    // Returned indexes are guaranteed to be in ascending order.
+    t_array_mut<t_i32> HierarchicalBitsetLoadIndexesOfSet(const t_hierarchical_bitset_rdonly hbs, t_arena *const arena);
+
+    // Same rules as the regular bitset walker apply.
+    struct t_hierarchical_bitset_walker {
+        t_bitset_rdonly bits;
+        t_bitset_walker summary_walker;
+
+        t_i32 word_index;
+        t_u64 word; // The remaining bits of the current word to visit.
+    };
+
+    inline t_hierarchical_bitset_walker HierarchicalBitsetWalkerCreate(const t_hierarchical_bitset_rdonly hbs) {
+        return {.bits = hbs.bits, .summary_walker = BitsetWalkerCreate(hbs.summary)};
+    }
+
+    // Returns false iff the walk has ended.
+    t_b8 HierarchicalBitsetWalk(t_hierarchical_bitset_walker *const walker, t_i32 *const o_index);
+
+#define ZCL_HIERARCHICAL_BITSET_WALK_SET(hbs, index)                                                                                                                                                                 \
+    for (zcl::t_hierarchical_bitset_walker ZCL_CONCAT(walker_l, __LINE__) = zcl::HierarchicalBitsetWalkerCreate(hbs); ZCL_CONCAT(walker_l, __LINE__).word_index != -2; ZCL_CONCAT(walker_l, __LINE__).word_index = -2) \
+        for (zcl::t_i32 index; zcl::HierarchicalBitsetWalk(&ZCL_CONCAT(walker_l, __LINE__), &index);)
+
+    // ==================================================
 }
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <zcl/zcl_basic.h>
+#include <zcl/zcl_strs.h>
+
+namespace zcl {
+    // ============================================================
+    // @section: File Loaders
+
+    // Loads whole files on a fixed set of worker threads, so that the thread asking for them (typically the one running the game tick) never waits on disk. Requests are handed in with FileLoaderSubmit, and the results are picked up later with FileLoaderPoll, in whatever order the loads happened to finish.
+    // Submitting and polling must both be done from the one thread, the one that owns the loader.
+    struct t_file_loader;
+
+    // Paths longer than this can't be submitted.
+    constexpr t_i32 k_file_load_path_len_limit = 256;
+
+    struct t_file_load_request {
+        t_str_rdonly path; // Copied on submission.
+
+        // The contents get pushed onto this from a worker thread, so nothing else may touch it (including other requests) until the request has been polled.
+        t_arena *contents_arena;
+        t_b8 add_terminator;
+
+        void *user_data; // Handed back untouched in the completion.
+    };
+
+    struct t_file_load_completion {
+        void *user_data;
+
+        t_b8 success; // False iff the file couldn't be opened or read.
+        t_array_mut<t_u8> contents; // Allocated on the request's arena. Empty on failure.
+    };
+
+    // The request capacity is how many requests can be outstanding (submitted but not yet polled) at once, and must be a power of 2.
+    t_file_loader *FileLoaderCreate(const t_i32 worker_cnt, const t_i32 request_cap, t_arena *const arena);
+
+    // Waits for all submitted requests to finish loading, then joins the worker threads. Any completions not yet polled are discarded.
+    void FileLoaderDestroy(t_file_loader *const loader);
+
+    // Returns false iff the loader already has as many outstanding requests as it can hold.
+    [[nodiscard]] t_b8 FileLoaderSubmit(t_file_loader *const loader, const t_file_load_request &request);
+
+    // Gives one finished request, if there are any. Meant to be called in a loop once per tick until it returns false.
+    [[nodiscard]] t_b8 FileLoaderPoll(t_file_loader *const loader, t_file_load_completion *const o_completion);
+
+    // Gives the number of requests submitted but not yet polled. Once this hits 0, everything asked for has been delivered.
+    t_i32 FileLoaderGetOutstandingCount(const t_file_loader *const loader);
+
+    // ==================================================
+}
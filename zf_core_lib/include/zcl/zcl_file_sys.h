@@ -40,6 +40,10 @@ namespace zcl {
         t_b8 open;
         FILE *file_raw;
         t_stream_mode mode;
+
+        // Optional, see FileStreamSetWriteBuffer.
+        t_array_mut<t_u8> write_buf;
+        t_i32 write_buf_len;
     };
 
     inline t_file_stream FileStreamCreateOpen(FILE *const file_raw, const t_stream_mode mode) {
@@ -56,6 +60,14 @@ namespace zcl {
     // The file stream must be open to get a view into it.
     t_stream_view FileStreamGetView(t_file_stream *const stream);
 
+    // Has writes to the stream collect in the given buffer, which only gets written out to the file once full (or on flush or close). This turns lots of small writes into a few large ones. Writes at least as large as the buffer skip it.
+    // Anything still pending in the previous buffer is written out first. Giving an empty array stops buffering. The buffer must outlive the stream.
+    void FileStreamSetWriteBuffer(t_file_stream *const stream, const t_array_mut<t_u8> buf);
+
+    // Writes out whatever is pending in the write buffer. Returns false iff this failed, in which case the pending bytes are lost.
+    // This is done anyway on FileFlush and FileClose, but without any way of knowing whether it succeeded, so call this first if that matters.
+    [[nodiscard]] t_b8 FileStreamFlushWriteBuffer(t_file_stream *const stream);
+
     inline t_file_stream FileStreamCreateStdIn() {
         return FileStreamCreateOpen(stdin, ek_stream_mode_read);
     }
@@ -85,6 +97,7 @@ namespace zcl {
 
     // Leave o_stream_new as nullptr if you don't want it.
     // o_stream_new is allowed to be equal to stream_current.
+    // Anything pending in the write buffer of the current stream is written out first. The new stream is unbuffered.
     [[nodiscard]] t_b8 FileReopen(t_file_stream *const stream_current, const t_str_rdonly path, const t_file_access_mode mode, t_arena *const temp_arena, t_file_stream *const o_stream_new);
 
     void FileClose(t_file_stream *const stream);
@@ -95,5 +108,17 @@ namespace zcl {
 
     [[nodiscard]] t_b8 FileLoadContents(const t_str_rdonly path, t_arena *const contents_arena, t_arena *const temp_arena, t_array_mut<t_u8> *const o_contents, const t_b8 add_terminator = false);
 
+    // A read-only view of a file's contents mapped straight into memory, so it can be read in place rather than copied. Pages are only loaded in from disk when first touched, and are shared with any other process mapping the same file.
+    // The file must not be modified or truncated while it's mapped.
+    struct t_mapped_file {
+        t_array_rdonly<t_u8> contents;
+    };
+
+    // Empty files are fine, and give empty contents. Files of 2 GiB or more can't be mapped.
+    [[nodiscard]] t_b8 FileMap(const t_str_rdonly path, t_arena *const temp_arena, t_mapped_file *const o_mapped_file);
+
+    // Invalidates the contents view.
+    void FileUnmap(t_mapped_file *const mapped_file);
+
     // ==================================================
 }
@@ -241,11 +241,19 @@ namespace zcl {
         t_code_point b;
     };
 
+    // ASCII and Latin-1 Supplement, which is where nearly all glyph lookups land.
+    constexpr t_i32 k_font_glyph_table_code_point_cnt = 256;
+
     struct t_font_arrangement {
         t_i32 line_height;
+        t_i32 ascent; // From the top of a line down to the baseline. Glyph offsets already include this.
 
         t_hash_map<t_code_point, t_font_glyph_info> code_pts_to_glyph_infos;
 
+        // Direct-indexed copies of the glyph infos below k_font_glyph_table_code_point_cnt. These are derived from the hash map rather than serialized.
+        t_array_mut<t_font_glyph_info> glyph_table;
+        t_static_bitset<k_font_glyph_table_code_point_cnt> glyph_table_usage;
+
         t_b8 has_kernings;
         t_hash_map<t_font_code_point_pair, t_i32> code_pt_pairs_to_kernings;
     };
@@ -262,7 +270,67 @@ namespace zcl {
         return pa.a == pb.a && pa.b == pb.b;
     };
 
+    // Builds the dense glyph table from the glyph info hash map. Needs calling again if the hash map is modified.
+    void FontBuildGlyphTable(t_font_arrangement *const arrangement, t_arena *const arena);
+
+    // Falls back to the hash map if the code point is outside the dense table, or if the table was never built.
+    [[nodiscard]] inline t_b8 FontFindGlyphInfo(const t_font_arrangement &arrangement, const t_code_point code_pt, const t_font_glyph_info **const o_glyph_info) {
+        if (code_pt < k_font_glyph_table_code_point_cnt && arrangement.glyph_table.len > 0) {
+            if (!BitsetCheckSet(arrangement.glyph_table_usage, static_cast<t_i32>(code_pt))) {
+                return false;
+            }
+
+            *o_glyph_info = &arrangement.glyph_table[static_cast<t_i32>(code_pt)];
+            return true;
+        }
+
+        t_font_glyph_info *glyph_info;
+
+        if (!HashMapFind(&arrangement.code_pts_to_glyph_infos, code_pt, &glyph_info)) {
+            return false;
+        }
+
+        *o_glyph_info = glyph_info;
+        return true;
+    }
+
     [[nodiscard]] t_b8 FontLoadFromUnbuilt(const t_str_rdonly file_path, const t_i32 height, t_code_point_bitset *const code_pts, t_arena *const arrangement_arena, t_arena *const atlas_pixels_arr_arena, t_arena *const temp_arena, t_font_arrangement *const o_arrangement, t_array_mut<t_font_atlas_pixels_r8> *const o_atlas_pixels_arr);
 
+    constexpr t_b8 CodePointCheckCombiningMark(const t_code_point code_pt) {
+        return (code_pt >= 0x0300 && code_pt <= 0x036F)    // Combining Diacritical Marks
+            || (code_pt >= 0x0591 && code_pt <= 0x05BD)    // Hebrew points
+            || (code_pt >= 0x064B && code_pt <= 0x065F)    // Arabic harakat
+            || (code_pt >= 0x1AB0 && code_pt <= 0x1AFF)    // Combining Diacritical Marks Extended
+            || (code_pt >= 0x1DC0 && code_pt <= 0x1DFF)    // Combining Diacritical Marks Supplement
+            || (code_pt >= 0x20D0 && code_pt <= 0x20FF)    // Combining Diacritical Marks for Symbols
+            || (code_pt >= 0xFE20 && code_pt <= 0xFE2F);   // Combining Half Marks
+    }
+
+    constexpr t_b8 CodePointCheckRTL(const t_code_point code_pt) {
+        return (code_pt >= 0x0590 && code_pt <= 0x08FF)    // Hebrew, Arabic, Syriac, Thaana, NKo, Samaritan, Mandaic
+            || (code_pt >= 0xFB1D && code_pt <= 0xFDFF)    // Hebrew and Arabic presentation forms
+            || (code_pt >= 0xFE70 && code_pt <= 0xFEFF);   // Arabic presentation forms B
+    }
+
+    // Below this, no code point is a combining mark or right-to-left, so shaping can be skipped entirely.
+    constexpr t_code_point k_font_shaping_code_point_threshold = 0x0300;
+
+    struct t_font_shaped_glyph {
+        t_code_point code_pt;
+        t_i32 src_index; // Index of the code point within the line given to the shaper.
+        t_v2_i pos;      // Pen position relative to the beginning of the line, excluding the glyph offset.
+    };
+
+    struct t_font_shaped_line {
+        t_array_mut<t_font_shaped_glyph> glyphs; // In visual order, one per code point.
+        t_i32 width;
+    };
+
+    // Sits between UTF-8 decoding and glyph lookup, mapping a single line of code points (no line breaks) to positioned glyphs.
+    using t_font_shaper = t_font_shaped_line (*)(const t_array_rdonly<t_code_point> line, const t_font_arrangement &arrangement, t_arena *const arena);
+
+    // Attaches combining marks to the preceding glyph and reverses runs of right-to-left text. This is not full bidirectional support, just enough for simple mixed strings.
+    t_font_shaped_line FontShapeSimple(const t_array_rdonly<t_code_point> line, const t_font_arrangement &arrangement, t_arena *const arena);
+
     // ==================================================
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstring>
 #include <zcl/zcl_basic.h>
 
 namespace zcl {
@@ -101,6 +102,29 @@ namespace zcl {
         list->len = 0;
     }
 
+    namespace internal {
+        // If the backing array was the last allocation made in the arena and there's room after it, it just gets grown in place. Otherwise a new one is allocated and only the elements in use are copied over.
+        template <c_list_nonstatic tp_list_type>
+        void ListRealloc(tp_list_type *const list, const t_i32 cap_new, t_arena *const arena) {
+            using t_elem = typename tp_list_type::t_elem;
+
+            ZCL_ASSERT(cap_new > ListGetCap(list));
+
+            if (ArenaTryExtend(arena, list->backing_arr.raw, ZCL_SIZE_OF(t_elem) * ListGetCap(list), ZCL_SIZE_OF(t_elem) * cap_new)) {
+                list->backing_arr.len = cap_new;
+                return;
+            }
+
+            const auto backing_arr_new = ArenaPushArray<t_elem>(arena, cap_new);
+
+            if (list->len > 0) {
+                memcpy(backing_arr_new.raw, list->backing_arr.raw, static_cast<size_t>(ZCL_SIZE_OF(t_elem) * list->len));
+            }
+
+            *list = {backing_arr_new, list->len};
+        }
+    }
+
     template <c_list_nonstatic tp_list_type>
     void ListExtend(tp_list_type *const list, t_arena *const arena, const t_list_extension_cap_calculator cap_calculator = k_list_extension_cap_calculator_default) {
         ZCL_ASSERT(cap_calculator);
@@ -108,10 +132,7 @@ namespace zcl {
         const t_i32 cap_new = cap_calculator(ListGetCap(list));
         ZCL_ASSERT(cap_new > ListGetCap(list));
 
-        const auto backing_arr_new = ArenaPushArray<typename tp_list_type::t_elem>(arena, cap_new);
-        ArrayCopy(list->backing_arr, backing_arr_new);
-
-        *list = {backing_arr_new, list->len};
+        internal::ListRealloc(list, cap_new, arena);
     }
 
     template <c_list_nonstatic tp_list_type>
@@ -131,10 +152,7 @@ namespace zcl {
             return result;
         }();
 
-        const auto backing_arr_new = ArenaPushArray<typename tp_list_type::t_elem>(arena, cap_new);
-        ArrayCopy(list->backing_arr, backing_arr_new);
-
-        *list = {backing_arr_new, list->len};
+        internal::ListRealloc(list, cap_new, arena);
     }
 
     template <c_list tp_list_type>
@@ -156,10 +174,13 @@ namespace zcl {
     }
 
     template <c_list tp_list_type>
-    constexpr t_array_mut<typename tp_list_type::t_elem> ListAppendMany(tp_list_type *const list, const t_array_rdonly<typename tp_list_type::t_elem> values) {
+    t_array_mut<typename tp_list_type::t_elem> ListAppendMany(tp_list_type *const list, const t_array_rdonly<typename tp_list_type::t_elem> values) {
         ZCL_ASSERT(list->len + values.len <= ListGetCap(list));
 
-        ArrayCopy(values, ArraySliceFrom(list->backing_arr, list->len));
+        if (values.len > 0) {
+            memcpy(list->backing_arr.raw + list->len, values.raw, static_cast<size_t>(ZCL_SIZE_OF(typename tp_list_type::t_elem) * values.len));
+        }
+
         list->len += values.len;
         return ArraySlice(list->backing_arr, list->len - values.len, list->len);
     }
@@ -176,16 +197,13 @@ namespace zcl {
     }
 
     template <c_list tp_list_type>
-    constexpr typename tp_list_type::t_elem *ListInsertAt(tp_list_type *const list, const t_i32 index, const typename tp_list_type::t_elem &value) {
+    typename tp_list_type::t_elem *ListInsertAt(tp_list_type *const list, const t_i32 index, const typename tp_list_type::t_elem &value) {
         ZCL_ASSERT(list->len < ListGetCap(list));
         ZCL_ASSERT(index >= 0 && index <= list->len);
 
+        memmove(list->backing_arr.raw + index + 1, list->backing_arr.raw + index, static_cast<size_t>(ZCL_SIZE_OF(typename tp_list_type::t_elem) * (list->len - index)));
         list->len++;
 
-        for (t_i32 i = list->len - 1; i > index; i--) {
-            (*list)[i] = (*list)[i - 1];
-        }
-
         (*list)[index] = value;
 
         return &(*list)[index];
@@ -200,12 +218,41 @@ namespace zcl {
         return ListInsertAt(list, index, value);
     }
 
+    // Inserts all the values at once, shifting the elements after them along only once.
+    template <c_list tp_list_type>
+    t_array_mut<typename tp_list_type::t_elem> ListInsertManyAt(tp_list_type *const list, const t_i32 index, const t_array_rdonly<typename tp_list_type::t_elem> values) {
+        using t_elem = typename tp_list_type::t_elem;
+
+        ZCL_ASSERT(list->len + values.len <= ListGetCap(list));
+        ZCL_ASSERT(index >= 0 && index <= list->len);
+
+        if (values.len > 0) {
+            memmove(list->backing_arr.raw + index + values.len, list->backing_arr.raw + index, static_cast<size_t>(ZCL_SIZE_OF(t_elem) * (list->len - index)));
+            memcpy(list->backing_arr.raw + index, values.raw, static_cast<size_t>(ZCL_SIZE_OF(t_elem) * values.len));
+        }
+
+        list->len += values.len;
+
+        return ArraySlice(ListToArray(list), index, index + values.len);
+    }
+
+    template <c_list_nonstatic tp_list_type>
+    t_array_mut<typename tp_list_type::t_elem> ListInsertManyAtDynamic(tp_list_type *const list, const t_i32 index, const t_array_rdonly<typename tp_list_type::t_elem> values, t_arena *const extension_arena, const t_list_extension_cap_calculator extension_cap_calculator = k_list_extension_cap_calculator_default) {
+        const auto min_cap_needed = list->len + values.len;
+
+        if (min_cap_needed > ListGetCap(list)) {
+            ListExtendToFit(list, min_cap_needed, extension_arena, extension_cap_calculator);
+        }
+
+        return ListInsertManyAt(list, index, values);
+    }
+
     template <c_list tp_list_type>
-    constexpr void ListRemoveAtShift(tp_list_type *const list, const t_i32 index) {
+    void ListRemoveAtShift(tp_list_type *const list, const t_i32 index) {
         ZCL_ASSERT(list->len > 0);
         ZCL_ASSERT(index >= 0 && index < list->len);
 
-        ArrayCopy(ArraySlice(list->backing_arr, index + 1, list->len), ArraySlice(list->backing_arr, index, list->len - 1));
+        memmove(list->backing_arr.raw + index, list->backing_arr.raw + index + 1, static_cast<size_t>(ZCL_SIZE_OF(typename tp_list_type::t_elem) * (list->len - index - 1)));
         list->len--;
     }
 
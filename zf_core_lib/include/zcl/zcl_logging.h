@@ -0,0 +1,111 @@
+#pragma once
+
+#include <source_location>
+#include <zcl/zcl_basic.h>
+#include <zcl/zcl_printing.h>
+
+namespace zcl {
+    // ============================================================
+    // @section: Loggers
+
+    // A logger hands records off to a background thread, which does the timestamp formatting and the actual writing to the console and/or a file. Logging calls therefore never wait on I/O.
+    // Each thread that logs gets its own ring to put records into (up to a limit, beyond which threads share one), so threads never contend with one another either. If a ring is full the record is dropped, and how many were dropped gets reported in the output.
+    // Records from the same thread are always written in order, but there is no ordering guarantee across threads beyond what the timestamps give.
+    struct t_logger;
+
+    enum t_log_level : t_i32 {
+        ek_log_level_debug,
+        ek_log_level_info,
+        ek_log_level_warning,
+        ek_log_level_error,
+
+        ekm_log_level_cnt
+    };
+
+    // Categories are indexes into the category names given in the config, and can be filtered independently of levels.
+    using t_log_category = t_i32;
+
+    constexpr t_log_category k_log_category_default = 0;
+    constexpr t_i32 k_log_category_limit = 64;
+
+    // Messages longer than this get truncated.
+    constexpr t_i32 k_log_msg_len_limit = 192;
+
+    struct t_logger_config {
+        t_b8 console; // Debug and info records go to stdout, warnings and errors to stderr.
+
+        t_str_rdonly file_path; // Leave empty for no file output. Directories in the path are created as needed.
+        t_i32 file_size_limit; // Once the file would grow past this many bytes it gets rotated out ("log.txt" becomes "log.txt.1" and so on). 0 for no limit.
+        t_i32 file_rotation_cnt; // How many rotated-out files to keep around.
+
+        t_array_rdonly<t_str_rdonly> category_names; // Can be left empty, in which case categories are printed as numbers.
+
+        t_log_level level_min;
+
+        t_i32 thread_ring_cap; // Must be a power of 2.
+    };
+
+    inline t_logger_config LoggerConfigCreate() {
+        return {
+            .console = true,
+
+            .file_path = {},
+            .file_size_limit = MegabytesToBytes(8),
+            .file_rotation_cnt = 3,
+
+            .category_names = {},
+
+            .level_min = ek_log_level_info,
+
+            .thread_ring_cap = 256,
+        };
+    }
+
+    // Starts the background thread. The config strings are copied.
+    // Returns false iff the log file couldn't be opened.
+    [[nodiscard]] t_b8 LoggerCreate(const t_logger_config &config, t_arena *const arena, t_logger **const o_logger);
+
+    // Writes out everything still pending, then joins the background thread. No thread may be logging to it at this point.
+    void LoggerDestroy(t_logger *const logger);
+
+    // Blocks until all records that the calling thread has submitted so far have been written out.
+    void LoggerFlush(t_logger *const logger);
+
+    void LoggerSetLevelMin(t_logger *const logger, const t_log_level level);
+
+    void LoggerSetCategoryEnabled(t_logger *const logger, const t_log_category category, const t_b8 enabled);
+
+    t_b8 LoggerCheckEnabled(const t_logger *const logger, const t_log_level level, const t_log_category category);
+
+    // Like a format string, but also capturing where in the source it was written.
+    template <typename... tp_arg_types>
+    struct t_log_format {
+        template <t_i32 tp_buf_size>
+        consteval t_log_format(const char (&buf)[tp_buf_size], const std::source_location src_loc = std::source_location::current()) : format(buf), src_loc(src_loc) {}
+
+        t_print_format<tp_arg_types...> format;
+        std::source_location src_loc;
+    };
+
+    namespace internal {
+        void LoggerSubmit(t_logger *const logger, const t_log_level level, const t_log_category category, const std::source_location &src_loc, const t_array_rdonly<t_u8> msg, const t_b8 msg_truncated);
+    }
+
+    // The message is formatted on the calling thread (into a fixed-size buffer, no allocation) and everything else happens on the background thread.
+    template <typename... tp_arg_types>
+    void LoggerWrite(t_logger *const logger, const t_log_level level, const t_log_category category, const t_log_format<t_nondeduced<tp_arg_types>...> format, const tp_arg_types &...args) {
+        if (!LoggerCheckEnabled(logger, level, category)) {
+            return;
+        }
+
+        t_static_array<t_u8, k_log_msg_len_limit> msg_bytes;
+        t_byte_stream msg_stream = ByteStreamCreate(ArrayToNonstatic(&msg_bytes), ek_stream_mode_write);
+
+        // This only fails if the buffer ran out, in which case whatever fit is kept.
+        const t_b8 msg_truncated = !PrintFormat(ByteStreamGetView(&msg_stream), format.format, args...);
+
+        internal::LoggerSubmit(logger, level, category, format.src_loc, ByteStreamGetWritten(&msg_stream), msg_truncated);
+    }
+
+    // ==================================================
+}
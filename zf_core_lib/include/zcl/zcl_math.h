@@ -379,36 +379,46 @@ namespace zcl {
         return rads * (180.0f / k_pi);
     }
 
+    // Gives the number of decimal digits in the integer, not counting any sign.
     template <c_integral tp_type>
     constexpr t_i32 CalcDigitCount(const tp_type n) {
-        if (n < 0) {
-            return CalcDigitCount(-n);
+        // Negatives are stepped towards zero as they are rather than negated, since the minimum value can't be.
+        tp_type n_mut = n;
+        t_i32 result = 1;
+
+        if constexpr (c_integral_signed<tp_type>) {
+            while (n_mut <= -10) {
+                n_mut /= 10;
+                result++;
+            }
         }
 
-        if (n < 10) {
-            return 1;
+        while (n_mut >= 10) {
+            n_mut /= 10;
+            result++;
         }
 
-        return 1 + CalcDigitCount(n / 10);
+        return result;
     }
 
+    // Gives the decimal digit at the given index, where index 0 is the least significant digit. Always non-negative.
     template <c_integral tp_type>
     constexpr tp_type CalcDigitAt(const tp_type n, const t_i32 index) {
         ZCL_ASSERT(index >= 0 && index < CalcDigitCount(n));
 
-        if (n < 0) {
-            return CalcDigitAt(-n, index);
-        }
+        tp_type n_mut = n;
 
-        if (index == 0) {
-            return n % 10;
+        for (t_i32 i = 0; i < index; i++) {
+            n_mut /= 10;
         }
 
-        if (n < 10) {
-            return 0;
-        }
+        const auto result = static_cast<tp_type>(n_mut % 10);
 
-        return CalcDigitAt(n / 10, index - 1);
+        if constexpr (c_integral_signed<tp_type>) {
+            return result < 0 ? static_cast<tp_type>(-result) : result;
+        } else {
+            return result;
+        }
     }
 
     constexpr t_v2 V2IToF(const t_v2_i v) {
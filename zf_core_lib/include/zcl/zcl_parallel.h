@@ -0,0 +1,264 @@
+#pragma once
+
+#include <atomic>
+#include <zcl/zcl_basic.h>
+#include <zcl/zcl_algos.h>
+
+namespace zcl {
+    // ============================================================
+    // @section: Worker Pools
+
+    // A set of threads which sit idle until given a batch of tasks to run. The thread submitting the batch also works on it, so a pool with N workers runs batches on N + 1 threads.
+    // A pool can only run one batch at a time, and tasks cannot submit batches to the pool they're running on.
+    struct t_worker_pool;
+
+    // Gives one less than the number of hardware threads, to leave room for the thread submitting the work.
+    t_i32 WorkerPoolGetDefaultWorkerCount();
+
+    // A worker count of 0 is allowed, in which case batches just run on the submitting thread.
+    t_worker_pool *WorkerPoolCreate(const t_i32 worker_cnt, t_arena *const arena);
+
+    // Joins all worker threads. The pool memory itself belongs to the arena it was created with.
+    void WorkerPoolDestroy(t_worker_pool *const pool);
+
+    t_i32 WorkerPoolGetWorkerCount(const t_worker_pool *const pool);
+
+    using t_worker_pool_task_func = void (*)(const t_i32 task_index, void *const user_data);
+
+    // Runs the function for every task index in [0, task_cnt) across the pool, and returns once all have finished. There is no guarantee on which thread runs which task, or in what order.
+    void WorkerPoolRunRaw(t_worker_pool *const pool, const t_i32 task_cnt, const t_worker_pool_task_func func, void *const user_data);
+
+    namespace internal {
+        template <typename tp_func_type>
+        void WorkerPoolRunTask(const t_i32 task_index, void *const user_data) {
+            (*static_cast<const tp_func_type *>(user_data))(task_index);
+        }
+    }
+
+    // Same as above, but takes any callable accepting a task index.
+    template <typename tp_func_type>
+    void WorkerPoolRun(t_worker_pool *const pool, const t_i32 task_cnt, const tp_func_type &func) {
+        WorkerPoolRunRaw(pool, task_cnt, internal::WorkerPoolRunTask<tp_func_type>, const_cast<tp_func_type *>(&func));
+    }
+
+    // ==================================================
+
+    // ============================================================
+    // @section: Parallel Algorithms
+
+    // These split the array into contiguous chunks and hand each chunk to the pool as a task. Arrays too short to be worth splitting are processed on the calling thread.
+    // Functions given to these get called concurrently, so must be safe to call from multiple threads at once.
+
+    namespace internal {
+        // Chunks are never made shorter than this many elements, so that the overhead of a task stays small relative to its work.
+        constexpr t_i32 k_parallel_chunk_len_min = 2048;
+
+        // More chunks than threads lets faster threads pick up the slack of slower ones.
+        constexpr t_i32 k_parallel_chunks_per_thread = 4;
+
+        constexpr t_i32 k_parallel_chunk_limit = 256;
+
+        inline t_i32 ParallelCalcChunkCount(const t_worker_pool *const pool, const t_i32 len) {
+            // With no workers every chunk would run on the calling thread anyway, so splitting would only add merge work.
+            if (WorkerPoolGetWorkerCount(pool) == 0) {
+                return 1;
+            }
+
+            const t_i32 thread_cnt = WorkerPoolGetWorkerCount(pool) + 1;
+            const t_i32 chunk_cnt = CalcMin(len / k_parallel_chunk_len_min, thread_cnt * k_parallel_chunks_per_thread);
+            return Clamp(chunk_cnt, 1, k_parallel_chunk_limit);
+        }
+
+        // Gives the element index range [begin, end) of the given chunk.
+        inline void ParallelCalcChunkRange(const t_i32 len, const t_i32 chunk_cnt, const t_i32 chunk_index, t_i32 *const o_begin, t_i32 *const o_end) {
+            *o_begin = static_cast<t_i32>((static_cast<t_i64>(len) * chunk_index) / chunk_cnt);
+            *o_end = static_cast<t_i32>((static_cast<t_i64>(len) * (chunk_index + 1)) / chunk_cnt);
+        }
+    }
+
+    // Calls the function with each index range [begin, end) that the range [0, len) gets split into.
+    template <typename tp_func_type>
+    void ParallelForRanges(t_worker_pool *const pool, const t_i32 len, const tp_func_type &func) {
+        ZCL_ASSERT(len >= 0);
+
+        if (len == 0) {
+            return;
+        }
+
+        const t_i32 chunk_cnt = internal::ParallelCalcChunkCount(pool, len);
+
+        if (chunk_cnt == 1) {
+            func(0, len);
+            return;
+        }
+
+        WorkerPoolRun(pool, chunk_cnt, [len, chunk_cnt, &func](const t_i32 chunk_index) {
+            t_i32 begin, end;
+            internal::ParallelCalcChunkRange(len, chunk_cnt, chunk_index, &begin, &end);
+
+            func(begin, end);
+        });
+    }
+
+    // Calls the function with every index in [0, len).
+    template <typename tp_func_type>
+    void ParallelFor(t_worker_pool *const pool, const t_i32 len, const tp_func_type &func) {
+        ParallelForRanges(pool, len, [&func](const t_i32 begin, const t_i32 end) {
+            for (t_i32 i = begin; i < end; i++) {
+                func(i);
+            }
+        });
+    }
+
+    // Sets each destination element to the result of the function on the corresponding source element. The source and destination can be the same array.
+    template <c_array tp_src_arr_type, c_array_mut tp_dest_arr_type, typename tp_func_type>
+    void ParallelTransform(t_worker_pool *const pool, const tp_src_arr_type src, const tp_dest_arr_type dest, const tp_func_type &func) {
+        ZCL_ASSERT(src.len == dest.len);
+
+        ParallelForRanges(pool, src.len, [src, dest, &func](const t_i32 begin, const t_i32 end) {
+            for (t_i32 i = begin; i < end; i++) {
+                dest[i] = func(src[i]);
+            }
+        });
+    }
+
+    // Gives the number of elements for which the predicate returns true.
+    template <c_array tp_arr_type, typename tp_pred_type>
+    t_i32 ParallelCount(t_worker_pool *const pool, const tp_arr_type arr, const tp_pred_type &pred) {
+        t_static_array<t_i32, internal::k_parallel_chunk_limit> chunk_cnts = {};
+        const t_i32 chunk_cnt = internal::ParallelCalcChunkCount(pool, arr.len);
+
+        WorkerPoolRun(pool, chunk_cnt, [arr, chunk_cnt, &pred, &chunk_cnts](const t_i32 chunk_index) {
+            t_i32 begin, end;
+            internal::ParallelCalcChunkRange(arr.len, chunk_cnt, chunk_index, &begin, &end);
+
+            t_i32 cnt = 0;
+
+            for (t_i32 i = begin; i < end; i++) {
+                if (pred(arr[i])) {
+                    cnt++;
+                }
+            }
+
+            chunk_cnts[chunk_index] = cnt;
+        });
+
+        t_i32 result = 0;
+
+        for (t_i32 i = 0; i < chunk_cnt; i++) {
+            result += chunk_cnts[i];
+        }
+
+        return result;
+    }
+
+    // Returns true iff the predicate returns true for any element. Threads stop early once a match has been found by any of them.
+    template <c_array tp_arr_type, typename tp_pred_type>
+    t_b8 ParallelCheckAny(t_worker_pool *const pool, const tp_arr_type arr, const tp_pred_type &pred) {
+        std::atomic<t_b8> found = false;
+
+        ParallelForRanges(pool, arr.len, [arr, &pred, &found](const t_i32 begin, const t_i32 end) {
+            for (t_i32 i = begin; i < end; i++) {
+                if (found.load(std::memory_order_relaxed)) {
+                    return;
+                }
+
+                if (pred(arr[i])) {
+                    found.store(true, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        });
+
+        return found.load();
+    }
+
+    // Returns true iff the predicate returns true for every element. Like CheckAllEqual, this is false for an empty array.
+    template <c_array tp_arr_type, typename tp_pred_type>
+    t_b8 ParallelCheckAll(t_worker_pool *const pool, const tp_arr_type arr, const tp_pred_type &pred) {
+        if (arr.len == 0) {
+            return false;
+        }
+
+        return !ParallelCheckAny(pool, arr, [&pred](const typename tp_arr_type::t_elem &elem) { return !pred(elem); });
+    }
+
+    namespace internal {
+        template <c_array_mut tp_arr_type, typename tp_comparator_type>
+        void ParallelSortMerge(const tp_arr_type left, const tp_arr_type right, const tp_arr_type dest, const tp_comparator_type &comparator) {
+            ZCL_ASSERT(left.len + right.len == dest.len);
+
+            t_i32 i = 0;
+            t_i32 j = 0;
+
+            while (i < left.len && j < right.len) {
+                if (comparator(right[j], left[i]) < 0) {
+                    dest[i + j] = right[j];
+                    j++;
+                } else {
+                    dest[i + j] = left[i];
+                    i++;
+                }
+            }
+
+            ArrayCopy(ArraySliceFrom(left, i), ArraySliceFrom(dest, i + j));
+            ArrayCopy(ArraySliceFrom(right, j), ArraySliceFrom(dest, i + j + (left.len - i)));
+        }
+    }
+
+    // Each chunk is sorted on its own using RunQuickSort, then sorted chunks are merged pairwise (each merge being a task) until one remains.
+    // O(n log n) time complexity, and O(n) space complexity for a scratch buffer allocated on the temporary arena. Not stable.
+    template <c_array_mut tp_arr_type, typename tp_comparator_type = internal::t_comparator_ord_default_functor<typename tp_arr_type::t_elem>>
+    void ParallelSort(t_worker_pool *const pool, const tp_arr_type arr, t_arena *const temp_arena, const tp_comparator_type &comparator = {}) {
+        const t_i32 chunk_cnt = internal::ParallelCalcChunkCount(pool, arr.len);
+
+        if (chunk_cnt == 1) {
+            RunQuickSort(arr, comparator);
+            return;
+        }
+
+        WorkerPoolRun(pool, chunk_cnt, [arr, chunk_cnt, &comparator](const t_i32 chunk_index) {
+            t_i32 begin, end;
+            internal::ParallelCalcChunkRange(arr.len, chunk_cnt, chunk_index, &begin, &end);
+
+            RunQuickSort(ArraySlice(arr, begin, end), comparator);
+        });
+
+        // Merge runs back and forth between the array and the scratch buffer. A run made of chunks [a, b) always spans the same elements as those chunks, so the chunk ranges give the run boundaries.
+        const auto scratch = ArenaPushArray<typename tp_arr_type::t_elem>(temp_arena, arr.len);
+
+        t_array_mut<typename tp_arr_type::t_elem> src = {arr.raw, arr.len};
+        t_array_mut<typename tp_arr_type::t_elem> dest = scratch;
+
+        for (t_i32 run_chunk_cnt = 1; run_chunk_cnt < chunk_cnt; run_chunk_cnt *= 2) {
+            const t_i32 merge_cnt = (chunk_cnt + (2 * run_chunk_cnt) - 1) / (2 * run_chunk_cnt);
+
+            WorkerPoolRun(pool, merge_cnt, [src, dest, chunk_cnt, run_chunk_cnt, &comparator](const t_i32 merge_index) {
+                const t_i32 left_chunk_begin = merge_index * 2 * run_chunk_cnt;
+                const t_i32 right_chunk_begin = CalcMin(left_chunk_begin + run_chunk_cnt, chunk_cnt);
+                const t_i32 right_chunk_end = CalcMin(right_chunk_begin + run_chunk_cnt, chunk_cnt);
+
+                t_i32 begin, mid, end, unused;
+                internal::ParallelCalcChunkRange(src.len, chunk_cnt, left_chunk_begin, &begin, &unused);
+                internal::ParallelCalcChunkRange(src.len, chunk_cnt, right_chunk_begin, &mid, &unused);
+                internal::ParallelCalcChunkRange(src.len, chunk_cnt, right_chunk_end - 1, &unused, &end);
+
+                if (right_chunk_begin == chunk_cnt) {
+                    // No right run to merge with, so just carry the left one over.
+                    ArrayCopy(ArraySlice(src, begin, end), ArraySlice(dest, begin, end));
+                    return;
+                }
+
+                internal::ParallelSortMerge(ArraySlice(src, begin, mid), ArraySlice(src, mid, end), ArraySlice(dest, begin, end), comparator);
+            });
+
+            Swap(&src, &dest);
+        }
+
+        if (src.raw != arr.raw) {
+            ArrayCopy(src, dest);
+        }
+    }
+
+    // ==================================================
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <charconv>
 #include <zcl/zcl_basic.h>
 #include <zcl/zcl_file_sys.h>
 #include <zcl/zcl_math.h>
@@ -13,11 +14,6 @@ namespace zcl {
         return StreamWriteItemsOfArray(stream_view, str.bytes);
     }
 
-    inline t_b8 PrintFormat(const t_stream_view stream_view, const t_str_rdonly format);
-
-    template <typename tp_arg_type, typename... tp_arg_types_leftover>
-    t_b8 PrintFormat(const t_stream_view stream_view, const t_str_rdonly format, const tp_arg_type &arg, const tp_arg_types_leftover &...args_leftover);
-
     // ============================================================
     // @section: Bools
 
@@ -103,26 +99,84 @@ namespace zcl {
         return FormatInt(value);
     }
 
+    namespace internal {
+        // The ASCII digits of every number from 00 to 99, so that digits can be produced two at a time.
+        constexpr t_static_array<t_u8, 200> k_dec_digit_pairs = []() {
+            t_static_array<t_u8, 200> result = {};
+
+            for (t_i32 i = 0; i < 100; i++) {
+                result[2 * i] = static_cast<t_u8>('0' + (i / 10));
+                result[(2 * i) + 1] = static_cast<t_u8>('0' + (i % 10));
+            }
+
+            return result;
+        }();
+
+        // Fills the given array with the decimal digits of the value, which the array length must match the digit count of.
+        inline void PrintDecDigits(t_u64 value, const t_array_mut<t_u8> dest) {
+            ZCL_ASSERT(dest.len == CalcDigitCount(value));
+
+            t_i32 i = dest.len;
+
+            while (value >= 100) {
+                const auto pair_index = static_cast<t_i32>(value % 100);
+                value /= 100;
+
+                i -= 2;
+                dest[i] = k_dec_digit_pairs[2 * pair_index];
+                dest[i + 1] = k_dec_digit_pairs[(2 * pair_index) + 1];
+            }
+
+            if (value >= 10) {
+                const auto pair_index = static_cast<t_i32>(value);
+
+                i -= 2;
+                dest[i] = k_dec_digit_pairs[2 * pair_index];
+                dest[i + 1] = k_dec_digit_pairs[(2 * pair_index) + 1];
+            } else {
+                i--;
+                dest[i] = static_cast<t_u8>('0' + value);
+            }
+        }
+    }
+
     template <c_integral tp_type>
     t_b8 PrintType(const t_stream_view stream_view, const t_format_int<tp_type> format) {
-        t_static_array<t_u8, 20> str_bytes = {}; // Maximum possible number of ASCII characters needed to represent a 64-bit integer.
-        t_byte_stream str_bytes_stream = ByteStreamCreate(ArrayToNonstatic(&str_bytes), ek_stream_mode_write);
-        t_b8 str_bytes_stream_write_success = true;
+        constexpr t_i32 k_str_len_max = 20; // Maximum possible number of ASCII characters needed to represent a 64-bit integer.
 
-        if (format.value < 0) {
-            str_bytes_stream_write_success = StreamWriteItem(ByteStreamGetView(&str_bytes_stream), '-');
-            ZCL_ASSERT(str_bytes_stream_write_success);
+        // The digits go straight into the stream if it allows, otherwise they're put together here first.
+        t_static_array<t_u8, k_str_len_max> str_bytes_local;
+        t_array_mut<t_u8> str_bytes = StreamReserve(stream_view, k_str_len_max);
+        const t_b8 reserved = str_bytes.len > 0;
+
+        if (!reserved) {
+            str_bytes = ArrayToNonstatic(&str_bytes_local);
         }
 
-        const t_i32 dig_cnt = CalcDigitCount(format.value);
+        t_i32 str_len = 0;
 
-        for (t_i32 i = 0; i < dig_cnt; i++) {
-            const auto byte = static_cast<t_u8>('0' + CalcDigitAt(format.value, dig_cnt - 1 - i));
-            str_bytes_stream_write_success = StreamWriteItem(ByteStreamGetView(&str_bytes_stream), byte);
-            ZCL_ASSERT(str_bytes_stream_write_success);
+        // Work with the magnitude as unsigned, since negating the minimum value would overflow.
+        auto magnitude = static_cast<t_u64>(format.value);
+
+        if constexpr (c_integral_signed<tp_type>) {
+            if (format.value < 0) {
+                str_bytes[str_len] = '-';
+                str_len++;
+
+                magnitude = 0 - magnitude;
+            }
         }
 
-        return Print(stream_view, {ByteStreamGetWritten(&str_bytes_stream)});
+        const t_i32 dig_cnt = CalcDigitCount(magnitude);
+        internal::PrintDecDigits(magnitude, ArraySlice(str_bytes, str_len, str_len + dig_cnt));
+        str_len += dig_cnt;
+
+        if (reserved) {
+            StreamCommit(stream_view, str_len);
+            return true;
+        }
+
+        return Print(stream_view, {ArraySlice(str_bytes, 0, str_len)});
     }
 
     // ==================================================
@@ -130,7 +184,10 @@ namespace zcl {
     // ============================================================
     // @section: Floats
 
-    constexpr t_i32 k_format_float_precision_default = 6;
+    // Gives the fewest decimal places needed for the printed value to be read back as exactly the same value, e.g. 0.1f prints as "0.1" rather than "0.100000".
+    constexpr t_i32 k_format_float_precision_shortest = -1;
+
+    constexpr t_i32 k_format_float_precision_default = k_format_float_precision_shortest;
 
     template <c_floating_point tp_type>
     struct t_format_float {
@@ -155,36 +212,67 @@ namespace zcl {
         return FormatFloat(value);
     }
 
-    template <c_floating_point tp_type>
-    t_b8 PrintType(const t_stream_view stream_view, const t_format_float<tp_type> format) {
-        ZCL_ASSERT(format.precision > 0);
+    namespace internal {
+        // Returns the number of bytes written, or -1 if the array isn't long enough.
+        template <c_floating_point tp_type>
+        t_i32 PrintFloatChars(const t_format_float<tp_type> format, const t_array_mut<t_u8> dest) {
+            const auto dest_begin = reinterpret_cast<char *>(dest.raw);
+            const auto dest_end = dest_begin + dest.len;
 
-        t_static_array<t_u8, 400> str_bytes = {}; // Roughly more than how many bytes should ever be needed.
+            const std::to_chars_result result = format.precision == k_format_float_precision_shortest ? std::to_chars(dest_begin, dest_end, format.value, std::chars_format::fixed) : std::to_chars(dest_begin, dest_end, format.value, std::chars_format::fixed, format.precision);
 
-        t_i32 str_bytes_used = snprintf(reinterpret_cast<char *>(str_bytes.raw), str_bytes.k_len, "%.*f", format.precision, static_cast<t_f64>(format.value));
-
-        if (str_bytes_used < 0 || str_bytes_used >= str_bytes.k_len) {
-            return false;
-        }
+            if (result.ec != std::errc()) {
+                return -1;
+            }
 
-        if (format.trim_trailing_zeros) {
-            const auto str_bytes_relevant = ArraySlice(ArrayToNonstatic(&str_bytes), 0, str_bytes_used);
+            auto len = static_cast<t_i32>(result.ptr - dest_begin);
 
-            if (CheckAnyEqual(str_bytes_relevant, '.')) {
-                for (t_i32 i = str_bytes_used - 1;; i--) {
-                    if (str_bytes[i] == '0') {
-                        str_bytes_used--;
-                    } else if (str_bytes[i] == '.') {
-                        str_bytes_used--;
+            if (format.trim_trailing_zeros && CheckAnyEqual(ArraySlice(dest, 0, len), '.')) {
+                for (t_i32 i = len - 1;; i--) {
+                    if (dest[i] == '0') {
+                        len--;
+                    } else if (dest[i] == '.') {
+                        len--;
                         break;
                     } else {
                         break;
                     }
                 }
             }
+
+            return len;
         }
+    }
+
+    template <c_floating_point tp_type>
+    t_b8 PrintType(const t_stream_view stream_view, const t_format_float<tp_type> format) {
+        ZCL_ASSERT(format.precision >= 0 || format.precision == k_format_float_precision_shortest);
+
+        // Most values fit in this much, so first try printing straight into the stream.
+        constexpr t_i32 k_str_len_typical = 48;
 
-        return Print(stream_view, {ArraySlice(ArrayToNonstatic(&str_bytes), 0, str_bytes_used)});
+        const t_array_mut<t_u8> str_bytes_reserved = StreamReserve(stream_view, k_str_len_typical);
+
+        if (str_bytes_reserved.len > 0) {
+            const t_i32 str_len = internal::PrintFloatChars(format, str_bytes_reserved);
+
+            if (str_len != -1) {
+                StreamCommit(stream_view, str_len);
+                return true;
+            }
+
+            StreamCommit(stream_view, 0);
+        }
+
+        t_static_array<t_u8, 400> str_bytes; // Roughly more than how many bytes should ever be needed.
+
+        const t_i32 str_len = internal::PrintFloatChars(format, ArrayToNonstatic(&str_bytes));
+
+        if (str_len == -1) {
+            return false;
+        }
+
+        return Print(stream_view, {ArraySlice(ArrayToNonstatic(&str_bytes), 0, str_len)});
     }
 
     // ==================================================
@@ -361,7 +449,7 @@ namespace zcl {
     t_b8 PrintType(const t_stream_view stream_view, const t_array_format<tp_arr_type> format) {
         if (format.one_per_line) {
             for (t_i32 i = 0; i < format.value.len; i++) {
-                if (!PrintFormat(stream_view, ZCL_STR_LITERAL("[%] %%"), i, format.value[i], i < format.value.len - 1 ? ZCL_STR_LITERAL("\n") : ZCL_STR_LITERAL(""))) {
+                if (!PrintFormat(stream_view, "[%] %%", i, format.value[i], i < format.value.len - 1 ? ZCL_STR_LITERAL("\n") : ZCL_STR_LITERAL(""))) {
                     return false;
                 }
             }
@@ -371,7 +459,7 @@ namespace zcl {
             }
 
             for (t_i32 i = 0; i < format.value.len; i++) {
-                if (!PrintFormat(stream_view, ZCL_STR_LITERAL("%"), format.value[i])) {
+                if (!PrintFormat(stream_view, "%", format.value[i])) {
                     return false;
                 }
 
@@ -420,83 +508,156 @@ namespace zcl {
 
     // ==================================================
 
+    // ============================================================
+    // @section: Format Strings
+
     constexpr t_code_point k_print_format_spec = '%';
     constexpr t_code_point k_print_format_esc = '^';
 
-    t_i32 PrintFormatCountSpecs(const t_str_rdonly str);
+    // A format string which is checked against the arguments given with it and split up at its format specifiers, all at compile time. It can only be created from a string literal, which happens implicitly when one is passed to PrintFormat and the like.
+    // Use a single '%' as the format specifier. To actually include a '%' in the output, write "^%". To actually include a '^', write "^^".
+    template <typename... tp_arg_types>
+    struct t_print_format {
+        static constexpr t_i32 k_segment_cnt = sizeof...(tp_arg_types) + 1;
 
-    inline t_b8 PrintFormat(const t_stream_view stream_view, const t_str_rdonly format) {
-        ZCL_ASSERT(PrintFormatCountSpecs(format) == 0);
+        template <t_i32 tp_buf_size>
+        consteval t_print_format(const char (&buf)[tp_buf_size]) : raw(buf), len(tp_buf_size - 1) {
+            if (buf[tp_buf_size - 1]) {
+                throw "Static char array not terminated at end!";
+            }
 
-        // Just print the rest of the string, but still accounting for escape characters.
-        t_b8 escaped = false;
+            static_assert(CodePointCheckASCII(k_print_format_spec) && CodePointCheckASCII(k_print_format_esc)); // Assuming this for this algorithm.
 
-        for (t_i32 i = 0; i < format.bytes.len; i++) {
-            if (!escaped) {
-                if (format.bytes[i] == k_print_format_esc) {
-                    escaped = true;
+            t_i32 segment_index = 0;
+            t_b8 escaped = false;
+
+            for (t_i32 i = 0; i < len; i++) {
+                if (escaped) {
+                    escaped = false;
                     continue;
                 }
-            }
 
-            if (!StreamWriteItem(stream_view, format.bytes[i])) {
-                return false;
+                if (buf[i] == k_print_format_esc) {
+                    segment_escapes[segment_index] = true;
+                    escaped = true;
+                } else if (buf[i] == k_print_format_spec) {
+                    if (segment_index == k_segment_cnt - 1) {
+                        throw "More format specifiers than arguments!";
+                    }
+
+                    segment_ends[segment_index] = i;
+                    segment_index++;
+                }
             }
 
-            escaped = false;
-        }
+            if (escaped) {
+                throw "Format string ends with an unfinished escape!";
+            }
 
-        return true;
-    }
+            if (segment_index != k_segment_cnt - 1) {
+                throw "Fewer format specifiers than arguments!";
+            }
 
-    // Use a single '%' as the format specifier. To actually include a '%' in the output, write "^%". To actually include a '^', write "^^".
-    // Returns true iff the operation was successful.
-    template <typename tp_arg_type, typename... tp_arg_types_leftover>
-    t_b8 PrintFormat(const t_stream_view stream_view, const t_str_rdonly format, const tp_arg_type &arg, const tp_arg_types_leftover &...args_leftover) {
-        static_assert(!c_c_str<tp_arg_type>, "C-strings are prohibited from default formatting for error prevention.");
+            segment_ends[segment_index] = len;
+        }
 
-        ZCL_ASSERT(PrintFormatCountSpecs(format) == 1 + sizeof...(args_leftover));
+        const char *raw;
+        t_i32 len;
 
-        static_assert(CodePointCheckASCII(k_print_format_spec) && CodePointCheckASCII(k_print_format_esc)); // Assuming this for this algorithm.
+        // The text between specifiers, where segment i ends at the index of specifier i (or the end of the string for the last).
+        t_static_array<t_i32, k_segment_cnt> segment_ends = {};
+        t_static_array<t_b8, k_segment_cnt> segment_escapes = {}; // Segments without escapes can be printed as they are.
+    };
 
-        t_b8 escaped = false;
+    namespace internal {
+        // Prints the string with escape characters removed. Text between escape characters is written in runs rather than byte by byte.
+        inline t_b8 PrintUnescaped(const t_stream_view stream_view, const t_str_rdonly str) {
+            t_i32 run_begin = 0;
+            t_b8 escaped = false;
 
-        for (t_i32 i = 0; i < format.bytes.len; i++) {
-            if (!escaped) {
-                if (format.bytes[i] == k_print_format_esc) {
-                    escaped = true;
+            for (t_i32 i = 0; i < str.bytes.len; i++) {
+                if (escaped) {
+                    // The escaped byte is left to be written as part of the next run.
+                    escaped = false;
                     continue;
-                } else if (format.bytes[i] == k_print_format_spec) {
-                    if constexpr (c_format<tp_arg_type>) {
-                        if (!PrintType(stream_view, arg)) {
-                            return false;
-                        }
-                    } else {
-                        if (!PrintType(stream_view, Format(arg))) {
-                            return false;
-                        }
+                }
+
+                if (str.bytes[i] == k_print_format_esc) {
+                    if (!StreamWriteItemsOfArray(stream_view, ArraySlice(str.bytes, run_begin, i))) {
+                        return false;
                     }
 
-                    const t_str_rdonly format_leftover = {ArraySlice(format.bytes, i + 1, format.bytes.len)}; // The substring of everything after the format specifier.
-                    return PrintFormat(stream_view, format_leftover, args_leftover...);
+                    run_begin = i + 1;
+                    escaped = true;
                 }
             }
 
-            if (!StreamWriteItem(stream_view, format.bytes[i])) {
-                return false;
+            return StreamWriteItemsOfArray(stream_view, ArraySliceFrom(str.bytes, run_begin));
+        }
+
+        template <typename... tp_arg_types>
+        t_b8 PrintFormatSegment(const t_stream_view stream_view, const t_print_format<tp_arg_types...> &format, const t_i32 segment_index) {
+            const t_i32 begin = segment_index == 0 ? 0 : format.segment_ends[segment_index - 1] + 1;
+            const t_str_rdonly segment = {{reinterpret_cast<const t_u8 *>(format.raw) + begin, format.segment_ends[segment_index] - begin}};
+
+            if (format.segment_escapes[segment_index]) {
+                return PrintUnescaped(stream_view, segment);
             }
 
-            escaped = false;
+            return Print(stream_view, segment);
         }
 
-        return true;
+        template <typename tp_arg_type>
+        t_b8 PrintFormatArg(const t_stream_view stream_view, const tp_arg_type &arg) {
+            static_assert(!c_c_str<tp_arg_type>, "C-strings are prohibited from default formatting for error prevention.");
+
+            if constexpr (c_format<tp_arg_type>) {
+                return PrintType(stream_view, arg);
+            } else {
+                return PrintType(stream_view, Format(arg));
+            }
+        }
     }
 
+    // Returns true iff the operation was successful.
+    template <typename... tp_arg_types>
+    t_b8 PrintFormat(const t_stream_view stream_view, const t_print_format<t_nondeduced<tp_arg_types>...> format, const tp_arg_types &...args) {
+        t_i32 segment_index = 0;
+
+        if constexpr (sizeof...(tp_arg_types) > 0) {
+            const auto print_segment_and_arg = [stream_view, &format, &segment_index](const auto &arg) {
+                if (!internal::PrintFormatSegment(stream_view, format, segment_index)) {
+                    return false;
+                }
+
+                segment_index++;
+
+                return internal::PrintFormatArg(stream_view, arg);
+            };
+
+            if (!(print_segment_and_arg(args) && ...)) {
+                return false;
+            }
+        }
+
+        return internal::PrintFormatSegment(stream_view, format, segment_index);
+    }
+
+    // Appends formatted text to the string builder.
+    template <typename... tp_arg_types>
+    void StrBuilderAppendFormat(t_str_builder *const builder, const t_print_format<t_nondeduced<tp_arg_types>...> format, const tp_arg_types &...args) {
+        if (!PrintFormat(StrBuilderGetView(builder), format, args...)) {
+            ZCL_UNREACHABLE();
+        }
+    }
+
+    // ==================================================
+
     // ============================================================
     // @section: Logging Helpers
 
     template <typename... tp_arg_types>
-    t_b8 Log(const t_str_rdonly format, const tp_arg_types &...args) {
+    t_b8 Log(const t_print_format<t_nondeduced<tp_arg_types>...> format, const tp_arg_types &...args) {
         t_file_stream std_err = FileStreamCreateStdOut();
 
         if (!PrintFormat(FileStreamGetView(&std_err), format, args...)) {
@@ -511,7 +672,7 @@ namespace zcl {
     }
 
     template <typename... tp_arg_types>
-    t_b8 LogError(const t_str_rdonly format, const tp_arg_types &...args) {
+    t_b8 LogError(const t_print_format<t_nondeduced<tp_arg_types>...> format, const tp_arg_types &...args) {
         t_file_stream std_err = FileStreamCreateStdError();
 
         if (!Print(FileStreamGetView(&std_err), ZCL_STR_LITERAL("Error: "))) {
@@ -530,7 +691,7 @@ namespace zcl {
     }
 
     template <typename... tp_arg_types>
-    t_b8 LogWarning(const t_str_rdonly format, const tp_arg_types &...args) {
+    t_b8 LogWarning(const t_print_format<t_nondeduced<tp_arg_types>...> format, const tp_arg_types &...args) {
         t_file_stream std_err = FileStreamCreateStdError();
 
         if (!Print(FileStreamGetView(&std_err), ZCL_STR_LITERAL("Warning: "))) {
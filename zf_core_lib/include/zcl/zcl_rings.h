@@ -0,0 +1,225 @@
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <zcl/zcl_basic.h>
+
+namespace zcl {
+    // ============================================================
+    // @section: Concurrent Rings
+
+    // Bounded FIFO queues for handing values from one thread to another without locks or allocation. Pushing fails when a ring is full and popping fails when it's empty, and it's up to the caller whether to retry, yield or give up.
+    // Capacities have to be powers of 2 so that positions can be wrapped with a mask. Positions themselves only ever increase (wrapping around the 32-bit range), which is what lets a full ring be told apart from an empty one without wasting a slot.
+
+    // Data written by different threads is padded apart by at least this much, so that threads don't keep invalidating each other's cache lines (false sharing).
+    constexpr t_i32 k_cache_line_size = 64;
+
+    template <typename tp_type>
+    concept c_ring_elem = c_simple<tp_type> && c_same<tp_type, t_without_cvref<tp_type>>;
+
+    namespace internal {
+        constexpr t_b8 RingCapCheckValid(const t_i32 cap) {
+            return cap > 0 && cap <= (1 << 30) && (cap & (cap - 1)) == 0;
+        }
+    }
+
+    // ==================================================
+
+    // ============================================================
+    // @section: Single-Producer, Single-Consumer Rings
+
+    // Only one thread may push and only one thread may pop, but these can be different threads. Each side keeps a cached copy of the other side's position, so it only has to read the other side's cache line when the ring looks full or empty.
+    template <c_ring_elem tp_elem_type>
+    struct t_spsc_ring {
+        using t_elem = tp_elem_type;
+
+        t_array_mut<tp_elem_type> buf;
+
+        t_static_array<t_u8, k_cache_line_size> padding_0;
+
+        // Only written by the producer.
+        std::atomic<t_u32> write_pos;
+        t_u32 read_pos_cached;
+
+        t_static_array<t_u8, k_cache_line_size> padding_1;
+
+        // Only written by the consumer.
+        std::atomic<t_u32> read_pos;
+        t_u32 write_pos_cached;
+
+        t_static_array<t_u8, k_cache_line_size> padding_2;
+    };
+
+    template <c_ring_elem tp_elem_type>
+    t_spsc_ring<tp_elem_type> *SPSCRingCreate(const t_i32 cap, t_arena *const arena) {
+        ZCL_ASSERT(internal::RingCapCheckValid(cap));
+
+        const auto ring = new (ArenaPushRaw(arena, ZCL_SIZE_OF(t_spsc_ring<tp_elem_type>), ZCL_ALIGN_OF(t_spsc_ring<tp_elem_type>))) t_spsc_ring<tp_elem_type>();
+        ring->buf = ArenaPushArray<tp_elem_type>(arena, cap);
+
+        return ring;
+    }
+
+    template <c_ring_elem tp_elem_type>
+    t_i32 SPSCRingGetCap(const t_spsc_ring<tp_elem_type> *const ring) {
+        return ring->buf.len;
+    }
+
+    // Only to be called by the producer. Returns false iff the ring is full.
+    template <c_ring_elem tp_elem_type>
+    [[nodiscard]] t_b8 SPSCRingPush(t_spsc_ring<tp_elem_type> *const ring, const tp_elem_type &value) {
+        const t_u32 write_pos = ring->write_pos.load(std::memory_order_relaxed);
+        const auto cap = static_cast<t_u32>(ring->buf.len);
+
+        if (write_pos - ring->read_pos_cached == cap) {
+            ring->read_pos_cached = ring->read_pos.load(std::memory_order_acquire);
+
+            if (write_pos - ring->read_pos_cached == cap) {
+                return false;
+            }
+        }
+
+        ring->buf[static_cast<t_i32>(write_pos & (cap - 1))] = value;
+        ring->write_pos.store(write_pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // Only to be called by the consumer. Returns false iff the ring is empty.
+    template <c_ring_elem tp_elem_type>
+    [[nodiscard]] t_b8 SPSCRingPop(t_spsc_ring<tp_elem_type> *const ring, tp_elem_type *const o_value) {
+        const t_u32 read_pos = ring->read_pos.load(std::memory_order_relaxed);
+        const auto cap = static_cast<t_u32>(ring->buf.len);
+
+        if (read_pos == ring->write_pos_cached) {
+            ring->write_pos_cached = ring->write_pos.load(std::memory_order_acquire);
+
+            if (read_pos == ring->write_pos_cached) {
+                return false;
+            }
+        }
+
+        *o_value = ring->buf[static_cast<t_i32>(read_pos & (cap - 1))];
+        ring->read_pos.store(read_pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // ==================================================
+
+    // ============================================================
+    // @section: Multi-Producer, Multi-Consumer Rings
+
+    // Any number of threads may push and pop at once. Each cell carries a sequence number saying whose turn it is (a producer at position P waits for P, and a consumer at position P waits for P + 1), and threads claim positions by compare-and-swap. This is the bounded queue design by Dmitry Vyukov.
+    template <c_ring_elem tp_elem_type>
+    struct t_mpmc_ring_cell {
+        std::atomic<t_u32> seq;
+        tp_elem_type value;
+    };
+
+    template <c_ring_elem tp_elem_type>
+    struct t_mpmc_ring {
+        using t_elem = tp_elem_type;
+
+        t_mpmc_ring_cell<tp_elem_type> *cells;
+        t_i32 cap;
+
+        t_static_array<t_u8, k_cache_line_size> padding_0;
+
+        std::atomic<t_u32> write_pos;
+
+        t_static_array<t_u8, k_cache_line_size> padding_1;
+
+        std::atomic<t_u32> read_pos;
+
+        t_static_array<t_u8, k_cache_line_size> padding_2;
+    };
+
+    template <c_ring_elem tp_elem_type>
+    t_mpmc_ring<tp_elem_type> *MPMCRingCreate(const t_i32 cap, t_arena *const arena) {
+        ZCL_ASSERT(internal::RingCapCheckValid(cap));
+
+        const auto ring = new (ArenaPushRaw(arena, ZCL_SIZE_OF(t_mpmc_ring<tp_elem_type>), ZCL_ALIGN_OF(t_mpmc_ring<tp_elem_type>))) t_mpmc_ring<tp_elem_type>();
+
+        ring->cells = static_cast<t_mpmc_ring_cell<tp_elem_type> *>(ArenaPushRaw(arena, ZCL_SIZE_OF(t_mpmc_ring_cell<tp_elem_type>) * cap, ZCL_ALIGN_OF(t_mpmc_ring_cell<tp_elem_type>)));
+        ring->cap = cap;
+
+        for (t_i32 i = 0; i < cap; i++) {
+            new (&ring->cells[i]) t_mpmc_ring_cell<tp_elem_type>();
+            ring->cells[i].seq.store(static_cast<t_u32>(i), std::memory_order_relaxed);
+        }
+
+        return ring;
+    }
+
+    template <c_ring_elem tp_elem_type>
+    t_i32 MPMCRingGetCap(const t_mpmc_ring<tp_elem_type> *const ring) {
+        return ring->cap;
+    }
+
+    // Returns false iff the ring is full.
+    template <c_ring_elem tp_elem_type>
+    [[nodiscard]] t_b8 MPMCRingPush(t_mpmc_ring<tp_elem_type> *const ring, const tp_elem_type &value) {
+        const auto mask = static_cast<t_u32>(ring->cap - 1);
+
+        t_u32 pos = ring->write_pos.load(std::memory_order_relaxed);
+        t_mpmc_ring_cell<tp_elem_type> *cell;
+
+        while (true) {
+            cell = &ring->cells[pos & mask];
+
+            const auto seq_diff = static_cast<t_i32>(cell->seq.load(std::memory_order_acquire) - pos);
+
+            if (seq_diff == 0) {
+                // The cell is free for this position, so try to claim it. On failure this reloads the position.
+                if (ring->write_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (seq_diff < 0) {
+                // The cell still holds the value from a lap ago that hasn't been popped.
+                return false;
+            } else {
+                // Another producer got here first.
+                pos = ring->write_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = value;
+        cell->seq.store(pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // Returns false iff the ring is empty.
+    template <c_ring_elem tp_elem_type>
+    [[nodiscard]] t_b8 MPMCRingPop(t_mpmc_ring<tp_elem_type> *const ring, tp_elem_type *const o_value) {
+        const auto mask = static_cast<t_u32>(ring->cap - 1);
+
+        t_u32 pos = ring->read_pos.load(std::memory_order_relaxed);
+        t_mpmc_ring_cell<tp_elem_type> *cell;
+
+        while (true) {
+            cell = &ring->cells[pos & mask];
+
+            const auto seq_diff = static_cast<t_i32>(cell->seq.load(std::memory_order_acquire) - (pos + 1));
+
+            if (seq_diff == 0) {
+                if (ring->read_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (seq_diff < 0) {
+                // No value has been pushed for this position yet.
+                return false;
+            } else {
+                pos = ring->read_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        *o_value = cell->value;
+        cell->seq.store(pos + mask + 1, std::memory_order_release); // Hand the cell over to the producer one lap ahead.
+
+        return true;
+    }
+
+    // ==================================================
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <zcl/zcl_basic.h>
+
+namespace zcl {
+    // ============================================================
+    // @section: Slot Maps
+
+    // A slot map stores values contiguously and hands out a handle for each one. Handles stay valid until their value is removed, no matter what else gets added or removed, and a handle to a removed value is detected as stale rather than aliasing whatever reuses its slot.
+    // Adding, removing and looking up are all O(1). Values are kept densely packed (removal swaps the last value into the gap), so iterating over them is just iterating over an array, but it also means a value's address is NOT stable.
+
+    struct t_slot_map_handle {
+        t_i32 index;
+        t_i32 version; // 0 for a null handle, which is never valid.
+    };
+
+    template <typename tp_type>
+    concept c_slot_map_value = c_simple<tp_type> && c_same<tp_type, t_without_cvref<tp_type>>;
+
+    template <c_slot_map_value tp_value_type>
+    struct t_slot_map {
+        using t_value = tp_value_type;
+
+        // These are indexed by dense index, and only the first value_cnt elements are in use.
+        t_array_mut<tp_value_type> values;
+        t_array_mut<t_i32> value_slot_indexes;
+
+        // These are indexed by slot index. For a slot in use, the link is its dense index. For a free slot, it's the index of the next free slot (or -1).
+        t_array_mut<t_i32> slot_links;
+        t_array_mut<t_i32> slot_versions; // A slot's version is bumped on removal, so a free slot's version is always one not yet handed out.
+
+        t_i32 free_slot_head;
+        t_i32 value_cnt;
+    };
+
+    template <typename tp_type>
+    concept c_slot_map = c_same<t_without_cvref<tp_type>, t_slot_map<typename tp_type::t_value>>;
+
+    template <c_slot_map_value tp_value_type>
+    t_slot_map<tp_value_type> SlotMapCreate(const t_i32 cap, t_arena *const arena) {
+        ZCL_ASSERT(cap > 0);
+
+        t_slot_map<tp_value_type> result = {
+            .values = ArenaPushArray<tp_value_type>(arena, cap),
+            .value_slot_indexes = ArenaPushArray<t_i32>(arena, cap),
+            .slot_links = ArenaPushArray<t_i32>(arena, cap),
+            .slot_versions = ArenaPushArray<t_i32>(arena, cap),
+        };
+
+        for (t_i32 i = 0; i < cap; i++) {
+            result.slot_links[i] = i + 1 < cap ? i + 1 : -1;
+            result.slot_versions[i] = 1;
+        }
+
+        return result;
+    }
+
+    template <c_slot_map tp_slot_map_type>
+    t_i32 SlotMapGetCap(const tp_slot_map_type *const slot_map) {
+        return slot_map->values.len;
+    }
+
+    template <c_slot_map tp_slot_map_type>
+    t_i32 SlotMapGetCount(const tp_slot_map_type *const slot_map) {
+        return slot_map->value_cnt;
+    }
+
+    template <c_slot_map tp_slot_map_type>
+    t_b8 SlotMapCheckFull(const tp_slot_map_type *const slot_map) {
+        return slot_map->free_slot_head == -1;
+    }
+
+    // Returns true iff the handle refers to a value currently in the slot map.
+    template <c_slot_map tp_slot_map_type>
+    t_b8 SlotMapCheckValid(const tp_slot_map_type *const slot_map, const t_slot_map_handle handle) {
+        return handle.index >= 0 && handle.index < SlotMapGetCap(slot_map) && handle.version > 0 && handle.version == slot_map->slot_versions[handle.index];
+    }
+
+    // Returns false iff the slot map is full.
+    template <c_slot_map tp_slot_map_type>
+    [[nodiscard]] t_b8 SlotMapAdd(tp_slot_map_type *const slot_map, const typename tp_slot_map_type::t_value &value, t_slot_map_handle *const o_handle) {
+        if (SlotMapCheckFull(slot_map)) {
+            return false;
+        }
+
+        const t_i32 slot_index = slot_map->free_slot_head;
+        const t_i32 dense_index = slot_map->value_cnt;
+
+        slot_map->free_slot_head = slot_map->slot_links[slot_index];
+        slot_map->slot_links[slot_index] = dense_index;
+
+        slot_map->values[dense_index] = value;
+        slot_map->value_slot_indexes[dense_index] = slot_index;
+        slot_map->value_cnt++;
+
+        *o_handle = {slot_index, slot_map->slot_versions[slot_index]};
+
+        return true;
+    }
+
+    template <c_slot_map tp_slot_map_type>
+    [[nodiscard]] t_b8 SlotMapFind(const tp_slot_map_type *const slot_map, const t_slot_map_handle handle, typename tp_slot_map_type::t_value **const o_val) {
+        if (!SlotMapCheckValid(slot_map, handle)) {
+            return false;
+        }
+
+        *o_val = &slot_map->values[slot_map->slot_links[handle.index]];
+
+        return true;
+    }
+
+    // The handle must be valid.
+    template <c_slot_map tp_slot_map_type>
+    typename tp_slot_map_type::t_value *SlotMapGet(const tp_slot_map_type *const slot_map, const t_slot_map_handle handle) {
+        ZCL_ASSERT(SlotMapCheckValid(slot_map, handle));
+        return &slot_map->values[slot_map->slot_links[handle.index]];
+    }
+
+    namespace internal {
+        template <c_slot_map tp_slot_map_type>
+        void SlotMapFreeSlot(tp_slot_map_type *const slot_map, const t_i32 slot_index) {
+            if (slot_map->slot_versions[slot_index] == k_i32_max) {
+                slot_map->slot_versions[slot_index] = 1;
+            } else {
+                slot_map->slot_versions[slot_index]++;
+            }
+
+            slot_map->slot_links[slot_index] = slot_map->free_slot_head;
+            slot_map->free_slot_head = slot_index;
+        }
+    }
+
+    // Returns true iff the handle was valid and its value was removed. The last value gets moved into the gap left in the value array.
+    template <c_slot_map tp_slot_map_type>
+    t_b8 SlotMapRemove(tp_slot_map_type *const slot_map, const t_slot_map_handle handle) {
+        if (!SlotMapCheckValid(slot_map, handle)) {
+            return false;
+        }
+
+        const t_i32 dense_index = slot_map->slot_links[handle.index];
+        const t_i32 dense_index_last = slot_map->value_cnt - 1;
+
+        if (dense_index != dense_index_last) {
+            const t_i32 slot_index_last = slot_map->value_slot_indexes[dense_index_last];
+
+            slot_map->values[dense_index] = slot_map->values[dense_index_last];
+            slot_map->value_slot_indexes[dense_index] = slot_index_last;
+            slot_map->slot_links[slot_index_last] = dense_index;
+        }
+
+        slot_map->value_cnt--;
+
+        internal::SlotMapFreeSlot(slot_map, handle.index);
+
+        return true;
+    }
+
+    // Removes all values, invalidating every handle given out so far.
+    template <c_slot_map tp_slot_map_type>
+    void SlotMapClear(tp_slot_map_type *const slot_map) {
+        for (t_i32 i = 0; i < slot_map->value_cnt; i++) {
+            internal::SlotMapFreeSlot(slot_map, slot_map->value_slot_indexes[i]);
+        }
+
+        slot_map->value_cnt = 0;
+    }
+
+    // Gives the densely packed values, in no particular order. This is invalidated by adding or removing.
+    template <c_slot_map tp_slot_map_type>
+    t_array_mut<typename tp_slot_map_type::t_value> SlotMapGetValues(const tp_slot_map_type *const slot_map) {
+        return ArraySlice(slot_map->values, 0, slot_map->value_cnt);
+    }
+
+    // Gives the handle of the value at the given index of the dense value array.
+    template <c_slot_map tp_slot_map_type>
+    t_slot_map_handle SlotMapGetHandleOfDense(const tp_slot_map_type *const slot_map, const t_i32 dense_index) {
+        ZCL_ASSERT(dense_index >= 0 && dense_index < slot_map->value_cnt);
+
+        const t_i32 slot_index = slot_map->value_slot_indexes[dense_index];
+        return {slot_index, slot_map->slot_versions[slot_index]};
+    }
+
+    // ==================================================
+}
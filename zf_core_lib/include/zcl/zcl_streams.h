@@ -3,6 +3,7 @@
 #include <zcl/zcl_basic.h>
 #include <zcl/zcl_bits.h>
 #include <zcl/zcl_hash_maps.h>
+#include <zcl/zcl_lists.h>
 
 namespace zcl {
     // ============================================================
@@ -19,9 +20,35 @@ namespace zcl {
         t_b8 (*read_func)(const t_stream_view stream_view, const t_array_mut<t_u8> dest_bytes);
         t_b8 (*write_func)(const t_stream_view stream_view, const t_array_rdonly<t_u8> src_bytes);
 
+        // These are optional, for write streams backed by memory which can be written into directly. See StreamReserve.
+        t_array_mut<t_u8> (*reserve_func)(const t_stream_view stream_view, const t_i32 size);
+        void (*commit_func)(const t_stream_view stream_view, const t_i32 size);
+
         t_stream_mode mode;
     };
 
+    // Gives a region of the given size at the write position of the stream, for the caller to fill in directly rather than through a write call. How much of it was actually filled in then has to be given to StreamCommit before anything else is written.
+    // Returns an empty array if the stream doesn't support this or doesn't have the room, in which case the regular write functions should be used instead.
+    inline t_array_mut<t_u8> StreamReserve(const t_stream_view stream_view, const t_i32 size) {
+        ZCL_ASSERT(stream_view.mode == ek_stream_mode_write);
+        ZCL_ASSERT(size > 0);
+
+        if (!stream_view.reserve_func) {
+            return {};
+        }
+
+        return stream_view.reserve_func(stream_view, size);
+    }
+
+    // The size can't be more than what was reserved.
+    inline void StreamCommit(const t_stream_view stream_view, const t_i32 size) {
+        ZCL_ASSERT(stream_view.mode == ek_stream_mode_write);
+        ZCL_ASSERT(stream_view.commit_func);
+        ZCL_ASSERT(size >= 0);
+
+        stream_view.commit_func(stream_view, size);
+    }
+
     template <c_simple tp_type>
     [[nodiscard]] t_b8 StreamReadItem(const t_stream_view stream_view, tp_type *const o_item) {
         ZCL_ASSERT(stream_view.mode == ek_stream_mode_read);
@@ -109,10 +136,29 @@ namespace zcl {
             return true;
         };
 
+        const auto reserve_func = [](const t_stream_view stream_view, const t_i32 size) -> t_array_mut<t_u8> {
+            const auto byte_stream = static_cast<t_byte_stream *>(stream_view.data);
+
+            if (byte_stream->byte_pos + size > byte_stream->bytes.len) {
+                return {};
+            }
+
+            return ArraySlice(byte_stream->bytes, byte_stream->byte_pos, byte_stream->byte_pos + size);
+        };
+
+        const auto commit_func = [](const t_stream_view stream_view, const t_i32 size) {
+            const auto byte_stream = static_cast<t_byte_stream *>(stream_view.data);
+
+            ZCL_ASSERT(byte_stream->byte_pos + size <= byte_stream->bytes.len);
+            byte_stream->byte_pos += size;
+        };
+
         return {
             .data = stream,
             .read_func = read_func,
             .write_func = write_func,
+            .reserve_func = reserve_func,
+            .commit_func = commit_func,
             .mode = stream->mode,
         };
     }
@@ -123,4 +169,66 @@ namespace zcl {
     }
 
     // ==================================================
+
+    // ============================================================
+    // @section: Memory Stream
+
+    // A write stream into memory which grows on the arena as needed, for when the size of what's going to be written isn't known up front. Writes and reservations on it never fail.
+    // What's been written can be read back by creating a byte stream over it.
+    struct t_mem_stream {
+        t_list<t_u8> bytes;
+        t_arena *arena;
+    };
+
+    inline t_mem_stream MemStreamCreate(t_arena *const arena, const t_i32 cap = 256) {
+        return {.bytes = ListCreate<t_u8>(cap, arena), .arena = arena};
+    }
+
+    inline t_stream_view MemStreamGetView(t_mem_stream *const stream) {
+        const auto write_func = [](const t_stream_view stream_view, const t_array_rdonly<t_u8> src_bytes) {
+            ZCL_ASSERT(stream_view.mode == ek_stream_mode_write);
+
+            const auto mem_stream = static_cast<t_mem_stream *>(stream_view.data);
+            ListAppendManyDynamic(&mem_stream->bytes, src_bytes, mem_stream->arena);
+
+            return true;
+        };
+
+        const auto reserve_func = [](const t_stream_view stream_view, const t_i32 size) {
+            const auto mem_stream = static_cast<t_mem_stream *>(stream_view.data);
+
+            if (mem_stream->bytes.len + size > ListGetCap(&mem_stream->bytes)) {
+                ListExtendToFit(&mem_stream->bytes, mem_stream->bytes.len + size, mem_stream->arena);
+            }
+
+            return ArraySlice(mem_stream->bytes.backing_arr, mem_stream->bytes.len, mem_stream->bytes.len + size);
+        };
+
+        const auto commit_func = [](const t_stream_view stream_view, const t_i32 size) {
+            const auto mem_stream = static_cast<t_mem_stream *>(stream_view.data);
+
+            ZCL_ASSERT(mem_stream->bytes.len + size <= ListGetCap(&mem_stream->bytes));
+            mem_stream->bytes.len += size;
+        };
+
+        return {
+            .data = stream,
+            .write_func = write_func,
+            .reserve_func = reserve_func,
+            .commit_func = commit_func,
+            .mode = ek_stream_mode_write,
+        };
+    }
+
+    // This is a view straight into the stream's buffer, so writing further may invalidate it.
+    inline t_array_mut<t_u8> MemStreamGetWritten(const t_mem_stream *const stream) {
+        return ListToArray(&stream->bytes);
+    }
+
+    // Discards everything written so far, keeping the buffer for reuse.
+    inline void MemStreamClear(t_mem_stream *const stream) {
+        ListClear(&stream->bytes);
+    }
+
+    // ==================================================
 }
@@ -4,6 +4,8 @@
 #include <zcl/zcl_bits.h>
 #include <zcl/zcl_algos.h>
 #include <zcl/zcl_hash_maps.h>
+#include <zcl/zcl_lists.h>
+#include <zcl/zcl_streams.h>
 
 namespace zcl {
     // ============================================================
@@ -13,7 +15,8 @@ namespace zcl {
 
     using t_code_point = char32_t;
 
-    using t_code_point_bitset = t_static_bitset<k_code_point_count>;
+    // Hierarchical since the marked code points are usually only a tiny fraction of the full range.
+    using t_code_point_bitset = t_static_hierarchical_bitset<k_code_point_count>;
 
     constexpr t_i32 k_ascii_range_begin = 0;
     constexpr t_i32 k_ascii_range_end = 0x80;
@@ -196,6 +199,100 @@ namespace zcl {
 
     // ==================================================
 
+    // ============================================================
+    // @section: String Interning
+
+    // An interner maps each distinct string given to it to an ID, storing only one copy of each. Two strings interned with the same interner are equal iff their IDs are, so IDs can be compared and hashed in O(1) in place of the strings themselves.
+    // IDs are assigned from 0 in the order strings are first interned, and stay valid for as long as the interner does. IDs from different interners are not comparable.
+    struct t_str_interner;
+
+    struct t_str_id {
+        t_i32 index;
+    };
+
+    constexpr t_comparator_bin<t_str_id> k_str_id_comparator_bin = [](const t_str_id &a, const t_str_id &b) {
+        return a.index == b.index;
+    };
+
+    constexpr t_hash_func<t_str_id> k_str_id_hash_func = [](const t_str_id &key) {
+        return key.index;
+    };
+
+    inline t_b8 StrIDsCheckEqual(const t_str_id a, const t_str_id b) {
+        return a.index == b.index;
+    }
+
+    // The interner keeps hold of the arena, and uses it for all string copies and table growth.
+    t_str_interner *StrInternerCreate(t_arena *const arena, const t_i32 cap = 64);
+
+    t_i32 StrInternerGetCount(const t_str_interner *const interner);
+
+    // Gives the ID of the string, adding a copy of it to the interner if it isn't there already.
+    t_str_id StrIntern(t_str_interner *const interner, const t_str_rdonly str);
+
+    // Returns false iff the string hasn't been interned.
+    [[nodiscard]] t_b8 StrInternerFind(const t_str_interner *const interner, const t_str_rdonly str, t_str_id *const o_id);
+
+    // Gives the interner's copy of the string with the given ID.
+    t_str_rdonly StrInternerGetStr(const t_str_interner *const interner, const t_str_id id);
+
+    // ==================================================
+
+    // ============================================================
+    // @section: String Builders
+
+    // Accumulates a string in a buffer on the arena which grows geometrically as needed. While the buffer is the most recent allocation on its arena it grows in place, so building a string usually involves no copying beyond the appends themselves.
+    // This is a memory stream underneath, with the same growth behaviour.
+    struct t_str_builder {
+        t_mem_stream stream;
+    };
+
+    inline t_str_builder StrBuilderCreate(t_arena *const arena, const t_i32 cap = 64) {
+        return {.stream = MemStreamCreate(arena, cap)};
+    }
+
+    inline void StrBuilderAppend(t_str_builder *const builder, const t_str_rdonly str) {
+        ListAppendManyDynamic(&builder->stream.bytes, str.bytes, builder->stream.arena);
+    }
+
+    inline void StrBuilderAppendCodePoint(t_str_builder *const builder, const t_code_point code_pt) {
+        t_static_array<t_u8, 4> bytes;
+        t_i32 byte_cnt;
+        CodePointToUTF8Bytes(code_pt, &bytes, &byte_cnt);
+
+        ListAppendManyDynamic(&builder->stream.bytes, ArraySlice(ArrayToNonstatic(&bytes), 0, byte_cnt), builder->stream.arena);
+    }
+
+    // Gives a write stream which appends to the builder, for use with the printing functions. Writes and reservations on it never fail.
+    inline t_stream_view StrBuilderGetView(t_str_builder *const builder) {
+        return MemStreamGetView(&builder->stream);
+    }
+
+    inline t_i32 StrBuilderGetLen(const t_str_builder *const builder) {
+        return builder->stream.bytes.len;
+    }
+
+    // Discards what has been built so far, keeping the buffer for reuse.
+    inline void StrBuilderClear(t_str_builder *const builder) {
+        MemStreamClear(&builder->stream);
+    }
+
+    // Gives the string built so far. This is a view straight into the builder's buffer rather than a copy, so appending further may invalidate it.
+    inline t_str_mut StrBuilderGetStr(const t_str_builder *const builder) {
+        return {MemStreamGetWritten(&builder->stream)};
+    }
+
+    // Same as above, but with a null byte added at the end, so that it can be passed to StrToCStr. Like with StrCloneButAddTerminator the null byte is part of the string, but it isn't part of what's been built, so further appends overwrite it.
+    inline t_str_mut StrBuilderGetStrTerminated(t_str_builder *const builder) {
+        ListAppendDynamic(&builder->stream.bytes, static_cast<t_u8>(0), builder->stream.arena);
+        const t_str_mut result = StrBuilderGetStr(builder);
+        builder->stream.bytes.len--;
+
+        return result;
+    }
+
+    // ==================================================
+
     // ============================================================
     // @section: C-Strings
 
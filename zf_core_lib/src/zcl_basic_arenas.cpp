@@ -172,6 +172,67 @@ namespace zcl {
         }
     }
 
+    t_b8 ArenaTryExtend(t_arena *const arena, void *const buf, const t_i32 size, const t_i32 size_new) {
+        ZCL_ASSERT(size >= 0 && size_new >= size);
+
+        if (!buf) {
+            return false;
+        }
+
+        switch (arena->type) {
+            case ek_arena_type_block_based: {
+                const auto block_based = &arena->type_data.block_based;
+
+                if (!block_based->block_cur) {
+                    return false;
+                }
+
+                const auto block_buf = static_cast<t_u8 *>(block_based->block_cur->buf);
+
+                // The start check guards against an allocation that ends at the very end of the previous block, which malloc might have placed right before this one.
+                if (static_cast<t_u8 *>(buf) < block_buf || static_cast<t_u8 *>(buf) + size != block_buf + block_based->block_cur_offs) {
+                    return false;
+                }
+
+                const t_i32 offs_next = block_based->block_cur_offs + (size_new - size);
+
+                if (offs_next > block_based->block_cur->buf_size) {
+                    return false;
+                }
+
+                ZeroClear(block_buf + block_based->block_cur_offs, size_new - size);
+                block_based->block_cur_offs = offs_next;
+
+                return true;
+            }
+
+            case ek_arena_type_wrapping: {
+                const auto wrapping = &arena->type_data.wrapping;
+
+                const auto wrapping_buf = static_cast<t_u8 *>(wrapping->buf);
+
+                if (static_cast<t_u8 *>(buf) + size != wrapping_buf + wrapping->buf_offs) {
+                    return false;
+                }
+
+                const t_i32 offs_next = wrapping->buf_offs + (size_new - size);
+
+                if (offs_next > wrapping->buf_size) {
+                    return false;
+                }
+
+                ZeroClear(wrapping_buf + wrapping->buf_offs, size_new - size);
+                wrapping->buf_offs = offs_next;
+
+                return true;
+            }
+
+            default: {
+                ZCL_UNREACHABLE();
+            }
+        }
+    }
+
     void ArenaRewind(t_arena *const arena) {
         switch (arena->type) {
             case ek_arena_type_block_based: {
@@ -1,784 +1,91 @@
 #include <zcl/zcl_bits.h>
 
+#include <bit>
 #include <zcl/zcl_algos.h>
 
 namespace zcl {
-    constexpr t_static_array<t_i32, 256> k_byte_indexes_of_first_set_bit = {{
-        -1, // 0000 0000
-        0,  // 0000 0001
-        1,  // 0000 0010
-        0,  // 0000 0011
-        2,  // 0000 0100
-        0,  // 0000 0101
-        1,  // 0000 0110
-        0,  // 0000 0111
-        3,  // 0000 1000
-        0,  // 0000 1001
-        1,  // 0000 1010
-        0,  // 0000 1011
-        2,  // 0000 1100
-        0,  // 0000 1101
-        1,  // 0000 1110
-        0,  // 0000 1111
-        4,  // 0001 0000
-        0,  // 0001 0001
-        1,  // 0001 0010
-        0,  // 0001 0011
-        2,  // 0001 0100
-        0,  // 0001 0101
-        1,  // 0001 0110
-        0,  // 0001 0111
-        3,  // 0001 1000
-        0,  // 0001 1001
-        1,  // 0001 1010
-        0,  // 0001 1011
-        2,  // 0001 1100
-        0,  // 0001 1101
-        1,  // 0001 1110
-        0,  // 0001 1111
-        5,  // 0010 0000
-        0,  // 0010 0001
-        1,  // 0010 0010
-        0,  // 0010 0011
-        2,  // 0010 0100
-        0,  // 0010 0101
-        1,  // 0010 0110
-        0,  // 0010 0111
-        3,  // 0010 1000
-        0,  // 0010 1001
-        1,  // 0010 1010
-        0,  // 0010 1011
-        2,  // 0010 1100
-        0,  // 0010 1101
-        1,  // 0010 1110
-        0,  // 0010 1111
-        4,  // 0011 0000
-        0,  // 0011 0001
-        1,  // 0011 0010
-        0,  // 0011 0011
-        2,  // 0011 0100
-        0,  // 0011 0101
-        1,  // 0011 0110
-        0,  // 0011 0111
-        3,  // 0011 1000
-        0,  // 0011 1001
-        1,  // 0011 1010
-        0,  // 0011 1011
-        2,  // 0011 1100
-        0,  // 0011 1101
-        1,  // 0011 1110
-        0,  // 0011 1111
-        6,  // 0100 0000
-        0,  // 0100 0001
-        1,  // 0100 0010
-        0,  // 0100 0011
-        2,  // 0100 0100
-        0,  // 0100 0101
-        1,  // 0100 0110
-        0,  // 0100 0111
-        3,  // 0100 1000
-        0,  // 0100 1001
-        1,  // 0100 1010
-        0,  // 0100 1011
-        2,  // 0100 1100
-        0,  // 0100 1101
-        1,  // 0100 1110
-        0,  // 0100 1111
-        4,  // 0101 0000
-        0,  // 0101 0001
-        1,  // 0101 0010
-        0,  // 0101 0011
-        2,  // 0101 0100
-        0,  // 0101 0101
-        1,  // 0101 0110
-        0,  // 0101 0111
-        3,  // 0101 1000
-        0,  // 0101 1001
-        1,  // 0101 1010
-        0,  // 0101 1011
-        2,  // 0101 1100
-        0,  // 0101 1101
-        1,  // 0101 1110
-        0,  // 0101 1111
-        5,  // 0110 0000
-        0,  // 0110 0001
-        1,  // 0110 0010
-        0,  // 0110 0011
-        2,  // 0110 0100
-        0,  // 0110 0101
-        1,  // 0110 0110
-        0,  // 0110 0111
-        3,  // 0110 1000
-        0,  // 0110 1001
-        1,  // 0110 1010
-        0,  // 0110 1011
-        2,  // 0110 1100
-        0,  // 0110 1101
-        1,  // 0110 1110
-        0,  // 0110 1111
-        4,  // 0111 0000
-        0,  // 0111 0001
-        1,  // 0111 0010
-        0,  // 0111 0011
-        2,  // 0111 0100
-        0,  // 0111 0101
-        1,  // 0111 0110
-        0,  // 0111 0111
-        3,  // 0111 1000
-        0,  // 0111 1001
-        1,  // 0111 1010
-        0,  // 0111 1011
-        2,  // 0111 1100
-        0,  // 0111 1101
-        1,  // 0111 1110
-        0,  // 0111 1111
-        7,  // 1000 0000
-        0,  // 1000 0001
-        1,  // 1000 0010
-        0,  // 1000 0011
-        2,  // 1000 0100
-        0,  // 1000 0101
-        1,  // 1000 0110
-        0,  // 1000 0111
-        3,  // 1000 1000
-        0,  // 1000 1001
-        1,  // 1000 1010
-        0,  // 1000 1011
-        2,  // 1000 1100
-        0,  // 1000 1101
-        1,  // 1000 1110
-        0,  // 1000 1111
-        4,  // 1001 0000
-        0,  // 1001 0001
-        1,  // 1001 0010
-        0,  // 1001 0011
-        2,  // 1001 0100
-        0,  // 1001 0101
-        1,  // 1001 0110
-        0,  // 1001 0111
-        3,  // 1001 1000
-        0,  // 1001 1001
-        1,  // 1001 1010
-        0,  // 1001 1011
-        2,  // 1001 1100
-        0,  // 1001 1101
-        1,  // 1001 1110
-        0,  // 1001 1111
-        5,  // 1010 0000
-        0,  // 1010 0001
-        1,  // 1010 0010
-        0,  // 1010 0011
-        2,  // 1010 0100
-        0,  // 1010 0101
-        1,  // 1010 0110
-        0,  // 1010 0111
-        3,  // 1010 1000
-        0,  // 1010 1001
-        1,  // 1010 1010
-        0,  // 1010 1011
-        2,  // 1010 1100
-        0,  // 1010 1101
-        1,  // 1010 1110
-        0,  // 1010 1111
-        4,  // 1011 0000
-        0,  // 1011 0001
-        1,  // 1011 0010
-        0,  // 1011 0011
-        2,  // 1011 0100
-        0,  // 1011 0101
-        1,  // 1011 0110
-        0,  // 1011 0111
-        3,  // 1011 1000
-        0,  // 1011 1001
-        1,  // 1011 1010
-        0,  // 1011 1011
-        2,  // 1011 1100
-        0,  // 1011 1101
-        1,  // 1011 1110
-        0,  // 1011 1111
-        6,  // 1100 0000
-        0,  // 1100 0001
-        1,  // 1100 0010
-        0,  // 1100 0011
-        2,  // 1100 0100
-        0,  // 1100 0101
-        1,  // 1100 0110
-        0,  // 1100 0111
-        3,  // 1100 1000
-        0,  // 1100 1001
-        1,  // 1100 1010
-        0,  // 1100 1011
-        2,  // 1100 1100
-        0,  // 1100 1101
-        1,  // 1100 1110
-        0,  // 1100 1111
-        4,  // 1101 0000
-        0,  // 1101 0001
-        1,  // 1101 0010
-        0,  // 1101 0011
-        2,  // 1101 0100
-        0,  // 1101 0101
-        1,  // 1101 0110
-        0,  // 1101 0111
-        3,  // 1101 1000
-        0,  // 1101 1001
-        1,  // 1101 1010
-        0,  // 1101 1011
-        2,  // 1101 1100
-        0,  // 1101 1101
-        1,  // 1101 1110
-        0,  // 1101 1111
-        5,  // 1110 0000
-        0,  // 1110 0001
-        1,  // 1110 0010
-        0,  // 1110 0011
-        2,  // 1110 0100
-        0,  // 1110 0101
-        1,  // 1110 0110
-        0,  // 1110 0111
-        3,  // 1110 1000
-        0,  // 1110 1001
-        1,  // 1110 1010
-        0,  // 1110 1011
-        2,  // 1110 1100
-        0,  // 1110 1101
-        1,  // 1110 1110
-        0,  // 1110 1111
-        4,  // 1111 0000
-        0,  // 1111 0001
-        1,  // 1111 0010
-        0,  // 1111 0011
-        2,  // 1111 0100
-        0,  // 1111 0101
-        1,  // 1111 0110
-        0,  // 1111 0111
-        3,  // 1111 1000
-        0,  // 1111 1001
-        1,  // 1111 1010
-        0,  // 1111 1011
-        2,  // 1111 1100
-        0,  // 1111 1101
-        1,  // 1111 1110
-        0,  // 1111 1111
-    }};
-
-    constexpr t_static_array<t_i32, 256> k_byte_set_bit_counts = {{
-        0, // 0000 0000
-        1, // 0000 0001
-        1, // 0000 0010
-        2, // 0000 0011
-        1, // 0000 0100
-        2, // 0000 0101
-        2, // 0000 0110
-        3, // 0000 0111
-        1, // 0000 1000
-        2, // 0000 1001
-        2, // 0000 1010
-        3, // 0000 1011
-        2, // 0000 1100
-        3, // 0000 1101
-        3, // 0000 1110
-        4, // 0000 1111
-        1, // 0001 0000
-        2, // 0001 0001
-        2, // 0001 0010
-        3, // 0001 0011
-        2, // 0001 0100
-        3, // 0001 0101
-        3, // 0001 0110
-        4, // 0001 0111
-        2, // 0001 1000
-        3, // 0001 1001
-        3, // 0001 1010
-        4, // 0001 1011
-        3, // 0001 1100
-        4, // 0001 1101
-        4, // 0001 1110
-        5, // 0001 1111
-        1, // 0010 0000
-        2, // 0010 0001
-        2, // 0010 0010
-        3, // 0010 0011
-        2, // 0010 0100
-        3, // 0010 0101
-        3, // 0010 0110
-        4, // 0010 0111
-        2, // 0010 1000
-        3, // 0010 1001
-        3, // 0010 1010
-        4, // 0010 1011
-        3, // 0010 1100
-        4, // 0010 1101
-        4, // 0010 1110
-        5, // 0010 1111
-        2, // 0011 0000
-        3, // 0011 0001
-        3, // 0011 0010
-        4, // 0011 0011
-        3, // 0011 0100
-        4, // 0011 0101
-        4, // 0011 0110
-        5, // 0011 0111
-        3, // 0011 1000
-        4, // 0011 1001
-        4, // 0011 1010
-        5, // 0011 1011
-        4, // 0011 1100
-        5, // 0011 1101
-        5, // 0011 1110
-        6, // 0011 1111
-        1, // 0100 0000
-        2, // 0100 0001
-        2, // 0100 0010
-        3, // 0100 0011
-        2, // 0100 0100
-        3, // 0100 0101
-        3, // 0100 0110
-        4, // 0100 0111
-        2, // 0100 1000
-        3, // 0100 1001
-        3, // 0100 1010
-        4, // 0100 1011
-        3, // 0100 1100
-        4, // 0100 1101
-        4, // 0100 1110
-        5, // 0100 1111
-        2, // 0101 0000
-        3, // 0101 0001
-        3, // 0101 0010
-        4, // 0101 0011
-        3, // 0101 0100
-        4, // 0101 0101
-        4, // 0101 0110
-        5, // 0101 0111
-        3, // 0101 1000
-        4, // 0101 1001
-        4, // 0101 1010
-        5, // 0101 1011
-        4, // 0101 1100
-        5, // 0101 1101
-        5, // 0101 1110
-        6, // 0101 1111
-        2, // 0110 0000
-        3, // 0110 0001
-        3, // 0110 0010
-        4, // 0110 0011
-        3, // 0110 0100
-        4, // 0110 0101
-        4, // 0110 0110
-        5, // 0110 0111
-        3, // 0110 1000
-        4, // 0110 1001
-        4, // 0110 1010
-        5, // 0110 1011
-        4, // 0110 1100
-        5, // 0110 1101
-        5, // 0110 1110
-        6, // 0110 1111
-        3, // 0111 0000
-        4, // 0111 0001
-        4, // 0111 0010
-        5, // 0111 0011
-        4, // 0111 0100
-        5, // 0111 0101
-        5, // 0111 0110
-        6, // 0111 0111
-        4, // 0111 1000
-        5, // 0111 1001
-        5, // 0111 1010
-        6, // 0111 1011
-        5, // 0111 1100
-        6, // 0111 1101
-        6, // 0111 1110
-        7, // 0111 1111
-        1, // 1000 0000
-        2, // 1000 0001
-        2, // 1000 0010
-        3, // 1000 0011
-        2, // 1000 0100
-        3, // 1000 0101
-        3, // 1000 0110
-        4, // 1000 0111
-        2, // 1000 1000
-        3, // 1000 1001
-        3, // 1000 1010
-        4, // 1000 1011
-        3, // 1000 1100
-        4, // 1000 1101
-        4, // 1000 1110
-        5, // 1000 1111
-        2, // 1001 0000
-        3, // 1001 0001
-        3, // 1001 0010
-        4, // 1001 0011
-        3, // 1001 0100
-        4, // 1001 0101
-        4, // 1001 0110
-        5, // 1001 0111
-        3, // 1001 1000
-        4, // 1001 1001
-        4, // 1001 1010
-        5, // 1001 1011
-        4, // 1001 1100
-        5, // 1001 1101
-        5, // 1001 1110
-        6, // 1001 1111
-        2, // 1010 0000
-        3, // 1010 0001
-        3, // 1010 0010
-        4, // 1010 0011
-        3, // 1010 0100
-        4, // 1010 0101
-        4, // 1010 0110
-        5, // 1010 0111
-        3, // 1010 1000
-        4, // 1010 1001
-        4, // 1010 1010
-        5, // 1010 1011
-        4, // 1010 1100
-        5, // 1010 1101
-        5, // 1010 1110
-        6, // 1010 1111
-        3, // 1011 0000
-        4, // 1011 0001
-        4, // 1011 0010
-        5, // 1011 0011
-        4, // 1011 0100
-        5, // 1011 0101
-        5, // 1011 0110
-        6, // 1011 0111
-        4, // 1011 1000
-        5, // 1011 1001
-        5, // 1011 1010
-        6, // 1011 1011
-        5, // 1011 1100
-        6, // 1011 1101
-        6, // 1011 1110
-        7, // 1011 1111
-        2, // 1100 0000
-        3, // 1100 0001
-        3, // 1100 0010
-        4, // 1100 0011
-        3, // 1100 0100
-        4, // 1100 0101
-        4, // 1100 0110
-        5, // 1100 0111
-        3, // 1100 1000
-        4, // 1100 1001
-        4, // 1100 1010
-        5, // 1100 1011
-        4, // 1100 1100
-        5, // 1100 1101
-        5, // 1100 1110
-        6, // 1100 1111
-        3, // 1101 0000
-        4, // 1101 0001
-        4, // 1101 0010
-        5, // 1101 0011
-        4, // 1101 0100
-        5, // 1101 0101
-        5, // 1101 0110
-        6, // 1101 0111
-        4, // 1101 1000
-        5, // 1101 1001
-        5, // 1101 1010
-        6, // 1101 1011
-        5, // 1101 1100
-        6, // 1101 1101
-        6, // 1101 1110
-        7, // 1101 1111
-        3, // 1110 0000
-        4, // 1110 0001
-        4, // 1110 0010
-        5, // 1110 0011
-        4, // 1110 0100
-        5, // 1110 0101
-        5, // 1110 0110
-        6, // 1110 0111
-        4, // 1110 1000
-        5, // 1110 1001
-        5, // 1110 1010
-        6, // 1110 1011
-        5, // 1110 1100
-        6, // 1110 1101
-        6, // 1110 1110
-        7, // 1110 1111
-        4, // 1111 0000
-        5, // 1111 0001
-        5, // 1111 0010
-        6, // 1111 0011
-        5, // 1111 0100
-        6, // 1111 0101
-        6, // 1111 0110
-        7, // 1111 0111
-        5, // 1111 1000
-        6, // 1111 1001
-        6, // 1111 1010
-        7, // 1111 1011
-        6, // 1111 1100
-        7, // 1111 1101
-        7, // 1111 1110
-        8, // 1111 1111
-    }};
-
-    constexpr t_static_array<t_static_array<t_i32, 8>, 256> k_byte_set_bit_indexes = {{
-        {{0, 0, 0, 0, 0, 0, 0, 0}},
-        {{0, 0, 0, 0, 0, 0, 0, 0}},
-        {{1, 0, 0, 0, 0, 0, 0, 0}},
-        {{0, 1, 0, 0, 0, 0, 0, 0}},
-        {{2, 0, 0, 0, 0, 0, 0, 0}},
-        {{0, 2, 0, 0, 0, 0, 0, 0}},
-        {{1, 2, 0, 0, 0, 0, 0, 0}},
-        {{0, 1, 2, 0, 0, 0, 0, 0}},
-        {{3, 0, 0, 0, 0, 0, 0, 0}},
-        {{0, 3, 0, 0, 0, 0, 0, 0}},
-        {{1, 3, 0, 0, 0, 0, 0, 0}},
-        {{0, 1, 3, 0, 0, 0, 0, 0}},
-        {{2, 3, 0, 0, 0, 0, 0, 0}},
-        {{0, 2, 3, 0, 0, 0, 0, 0}},
-        {{1, 2, 3, 0, 0, 0, 0, 0}},
-        {{0, 1, 2, 3, 0, 0, 0, 0}},
-        {{4, 0, 0, 0, 0, 0, 0, 0}},
-        {{0, 4, 0, 0, 0, 0, 0, 0}},
-        {{1, 4, 0, 0, 0, 0, 0, 0}},
-        {{0, 1, 4, 0, 0, 0, 0, 0}},
-        {{2, 4, 0, 0, 0, 0, 0, 0}},
-        {{0, 2, 4, 0, 0, 0, 0, 0}},
-        {{1, 2, 4, 0, 0, 0, 0, 0}},
-        {{0, 1, 2, 4, 0, 0, 0, 0}},
-        {{3, 4, 0, 0, 0, 0, 0, 0}},
-        {{0, 3, 4, 0, 0, 0, 0, 0}},
-        {{1, 3, 4, 0, 0, 0, 0, 0}},
-        {{0, 1, 3, 4, 0, 0, 0, 0}},
-        {{2, 3, 4, 0, 0, 0, 0, 0}},
-        {{0, 2, 3, 4, 0, 0, 0, 0}},
-        {{1, 2, 3, 4, 0, 0, 0, 0}},
-        {{0, 1, 2, 3, 4, 0, 0, 0}},
-        {{5, 0, 0, 0, 0, 0, 0, 0}},
-        {{0, 5, 0, 0, 0, 0, 0, 0}},
-        {{1, 5, 0, 0, 0, 0, 0, 0}},
-        {{0, 1, 5, 0, 0, 0, 0, 0}},
-        {{2, 5, 0, 0, 0, 0, 0, 0}},
-        {{0, 2, 5, 0, 0, 0, 0, 0}},
-        {{1, 2, 5, 0, 0, 0, 0, 0}},
-        {{0, 1, 2, 5, 0, 0, 0, 0}},
-        {{3, 5, 0, 0, 0, 0, 0, 0}},
-        {{0, 3, 5, 0, 0, 0, 0, 0}},
-        {{1, 3, 5, 0, 0, 0, 0, 0}},
-        {{0, 1, 3, 5, 0, 0, 0, 0}},
-        {{2, 3, 5, 0, 0, 0, 0, 0}},
-        {{0, 2, 3, 5, 0, 0, 0, 0}},
-        {{1, 2, 3, 5, 0, 0, 0, 0}},
-        {{0, 1, 2, 3, 5, 0, 0, 0}},
-        {{4, 5, 0, 0, 0, 0, 0, 0}},
-        {{0, 4, 5, 0, 0, 0, 0, 0}},
-        {{1, 4, 5, 0, 0, 0, 0, 0}},
-        {{0, 1, 4, 5, 0, 0, 0, 0}},
-        {{2, 4, 5, 0, 0, 0, 0, 0}},
-        {{0, 2, 4, 5, 0, 0, 0, 0}},
-        {{1, 2, 4, 5, 0, 0, 0, 0}},
-        {{0, 1, 2, 4, 5, 0, 0, 0}},
-        {{3, 4, 5, 0, 0, 0, 0, 0}},
-        {{0, 3, 4, 5, 0, 0, 0, 0}},
-        {{1, 3, 4, 5, 0, 0, 0, 0}},
-        {{0, 1, 3, 4, 5, 0, 0, 0}},
-        {{2, 3, 4, 5, 0, 0, 0, 0}},
-        {{0, 2, 3, 4, 5, 0, 0, 0}},
-        {{1, 2, 3, 4, 5, 0, 0, 0}},
-        {{0, 1, 2, 3, 4, 5, 0, 0}},
-        {{6, 0, 0, 0, 0, 0, 0, 0}},
-        {{0, 6, 0, 0, 0, 0, 0, 0}},
-        {{1, 6, 0, 0, 0, 0, 0, 0}},
-        {{0, 1, 6, 0, 0, 0, 0, 0}},
-        {{2, 6, 0, 0, 0, 0, 0, 0}},
-        {{0, 2, 6, 0, 0, 0, 0, 0}},
-        {{1, 2, 6, 0, 0, 0, 0, 0}},
-        {{0, 1, 2, 6, 0, 0, 0, 0}},
-        {{3, 6, 0, 0, 0, 0, 0, 0}},
-        {{0, 3, 6, 0, 0, 0, 0, 0}},
-        {{1, 3, 6, 0, 0, 0, 0, 0}},
-        {{0, 1, 3, 6, 0, 0, 0, 0}},
-        {{2, 3, 6, 0, 0, 0, 0, 0}},
-        {{0, 2, 3, 6, 0, 0, 0, 0}},
-        {{1, 2, 3, 6, 0, 0, 0, 0}},
-        {{0, 1, 2, 3, 6, 0, 0, 0}},
-        {{4, 6, 0, 0, 0, 0, 0, 0}},
-        {{0, 4, 6, 0, 0, 0, 0, 0}},
-        {{1, 4, 6, 0, 0, 0, 0, 0}},
-        {{0, 1, 4, 6, 0, 0, 0, 0}},
-        {{2, 4, 6, 0, 0, 0, 0, 0}},
-        {{0, 2, 4, 6, 0, 0, 0, 0}},
-        {{1, 2, 4, 6, 0, 0, 0, 0}},
-        {{0, 1, 2, 4, 6, 0, 0, 0}},
-        {{3, 4, 6, 0, 0, 0, 0, 0}},
-        {{0, 3, 4, 6, 0, 0, 0, 0}},
-        {{1, 3, 4, 6, 0, 0, 0, 0}},
-        {{0, 1, 3, 4, 6, 0, 0, 0}},
-        {{2, 3, 4, 6, 0, 0, 0, 0}},
-        {{0, 2, 3, 4, 6, 0, 0, 0}},
-        {{1, 2, 3, 4, 6, 0, 0, 0}},
-        {{0, 1, 2, 3, 4, 6, 0, 0}},
-        {{5, 6, 0, 0, 0, 0, 0, 0}},
-        {{0, 5, 6, 0, 0, 0, 0, 0}},
-        {{1, 5, 6, 0, 0, 0, 0, 0}},
-        {{0, 1, 5, 6, 0, 0, 0, 0}},
-        {{2, 5, 6, 0, 0, 0, 0, 0}},
-        {{0, 2, 5, 6, 0, 0, 0, 0}},
-        {{1, 2, 5, 6, 0, 0, 0, 0}},
-        {{0, 1, 2, 5, 6, 0, 0, 0}},
-        {{3, 5, 6, 0, 0, 0, 0, 0}},
-        {{0, 3, 5, 6, 0, 0, 0, 0}},
-        {{1, 3, 5, 6, 0, 0, 0, 0}},
-        {{0, 1, 3, 5, 6, 0, 0, 0}},
-        {{2, 3, 5, 6, 0, 0, 0, 0}},
-        {{0, 2, 3, 5, 6, 0, 0, 0}},
-        {{1, 2, 3, 5, 6, 0, 0, 0}},
-        {{0, 1, 2, 3, 5, 6, 0, 0}},
-        {{4, 5, 6, 0, 0, 0, 0, 0}},
-        {{0, 4, 5, 6, 0, 0, 0, 0}},
-        {{1, 4, 5, 6, 0, 0, 0, 0}},
-        {{0, 1, 4, 5, 6, 0, 0, 0}},
-        {{2, 4, 5, 6, 0, 0, 0, 0}},
-        {{0, 2, 4, 5, 6, 0, 0, 0}},
-        {{1, 2, 4, 5, 6, 0, 0, 0}},
-        {{0, 1, 2, 4, 5, 6, 0, 0}},
-        {{3, 4, 5, 6, 0, 0, 0, 0}},
-        {{0, 3, 4, 5, 6, 0, 0, 0}},
-        {{1, 3, 4, 5, 6, 0, 0, 0}},
-        {{0, 1, 3, 4, 5, 6, 0, 0}},
-        {{2, 3, 4, 5, 6, 0, 0, 0}},
-        {{0, 2, 3, 4, 5, 6, 0, 0}},
-        {{1, 2, 3, 4, 5, 6, 0, 0}},
-        {{0, 1, 2, 3, 4, 5, 6, 0}},
-        {{7, 0, 0, 0, 0, 0, 0, 0}},
-        {{0, 7, 0, 0, 0, 0, 0, 0}},
-        {{1, 7, 0, 0, 0, 0, 0, 0}},
-        {{0, 1, 7, 0, 0, 0, 0, 0}},
-        {{2, 7, 0, 0, 0, 0, 0, 0}},
-        {{0, 2, 7, 0, 0, 0, 0, 0}},
-        {{1, 2, 7, 0, 0, 0, 0, 0}},
-        {{0, 1, 2, 7, 0, 0, 0, 0}},
-        {{3, 7, 0, 0, 0, 0, 0, 0}},
-        {{0, 3, 7, 0, 0, 0, 0, 0}},
-        {{1, 3, 7, 0, 0, 0, 0, 0}},
-        {{0, 1, 3, 7, 0, 0, 0, 0}},
-        {{2, 3, 7, 0, 0, 0, 0, 0}},
-        {{0, 2, 3, 7, 0, 0, 0, 0}},
-        {{1, 2, 3, 7, 0, 0, 0, 0}},
-        {{0, 1, 2, 3, 7, 0, 0, 0}},
-        {{4, 7, 0, 0, 0, 0, 0, 0}},
-        {{0, 4, 7, 0, 0, 0, 0, 0}},
-        {{1, 4, 7, 0, 0, 0, 0, 0}},
-        {{0, 1, 4, 7, 0, 0, 0, 0}},
-        {{2, 4, 7, 0, 0, 0, 0, 0}},
-        {{0, 2, 4, 7, 0, 0, 0, 0}},
-        {{1, 2, 4, 7, 0, 0, 0, 0}},
-        {{0, 1, 2, 4, 7, 0, 0, 0}},
-        {{3, 4, 7, 0, 0, 0, 0, 0}},
-        {{0, 3, 4, 7, 0, 0, 0, 0}},
-        {{1, 3, 4, 7, 0, 0, 0, 0}},
-        {{0, 1, 3, 4, 7, 0, 0, 0}},
-        {{2, 3, 4, 7, 0, 0, 0, 0}},
-        {{0, 2, 3, 4, 7, 0, 0, 0}},
-        {{1, 2, 3, 4, 7, 0, 0, 0}},
-        {{0, 1, 2, 3, 4, 7, 0, 0}},
-        {{5, 7, 0, 0, 0, 0, 0, 0}},
-        {{0, 5, 7, 0, 0, 0, 0, 0}},
-        {{1, 5, 7, 0, 0, 0, 0, 0}},
-        {{0, 1, 5, 7, 0, 0, 0, 0}},
-        {{2, 5, 7, 0, 0, 0, 0, 0}},
-        {{0, 2, 5, 7, 0, 0, 0, 0}},
-        {{1, 2, 5, 7, 0, 0, 0, 0}},
-        {{0, 1, 2, 5, 7, 0, 0, 0}},
-        {{3, 5, 7, 0, 0, 0, 0, 0}},
-        {{0, 3, 5, 7, 0, 0, 0, 0}},
-        {{1, 3, 5, 7, 0, 0, 0, 0}},
-        {{0, 1, 3, 5, 7, 0, 0, 0}},
-        {{2, 3, 5, 7, 0, 0, 0, 0}},
-        {{0, 2, 3, 5, 7, 0, 0, 0}},
-        {{1, 2, 3, 5, 7, 0, 0, 0}},
-        {{0, 1, 2, 3, 5, 7, 0, 0}},
-        {{4, 5, 7, 0, 0, 0, 0, 0}},
-        {{0, 4, 5, 7, 0, 0, 0, 0}},
-        {{1, 4, 5, 7, 0, 0, 0, 0}},
-        {{0, 1, 4, 5, 7, 0, 0, 0}},
-        {{2, 4, 5, 7, 0, 0, 0, 0}},
-        {{0, 2, 4, 5, 7, 0, 0, 0}},
-        {{1, 2, 4, 5, 7, 0, 0, 0}},
-        {{0, 1, 2, 4, 5, 7, 0, 0}},
-        {{3, 4, 5, 7, 0, 0, 0, 0}},
-        {{0, 3, 4, 5, 7, 0, 0, 0}},
-        {{1, 3, 4, 5, 7, 0, 0, 0}},
-        {{0, 1, 3, 4, 5, 7, 0, 0}},
-        {{2, 3, 4, 5, 7, 0, 0, 0}},
-        {{0, 2, 3, 4, 5, 7, 0, 0}},
-        {{1, 2, 3, 4, 5, 7, 0, 0}},
-        {{0, 1, 2, 3, 4, 5, 7, 0}},
-        {{6, 7, 0, 0, 0, 0, 0, 0}},
-        {{0, 6, 7, 0, 0, 0, 0, 0}},
-        {{1, 6, 7, 0, 0, 0, 0, 0}},
-        {{0, 1, 6, 7, 0, 0, 0, 0}},
-        {{2, 6, 7, 0, 0, 0, 0, 0}},
-        {{0, 2, 6, 7, 0, 0, 0, 0}},
-        {{1, 2, 6, 7, 0, 0, 0, 0}},
-        {{0, 1, 2, 6, 7, 0, 0, 0}},
-        {{3, 6, 7, 0, 0, 0, 0, 0}},
-        {{0, 3, 6, 7, 0, 0, 0, 0}},
-        {{1, 3, 6, 7, 0, 0, 0, 0}},
-        {{0, 1, 3, 6, 7, 0, 0, 0}},
-        {{2, 3, 6, 7, 0, 0, 0, 0}},
-        {{0, 2, 3, 6, 7, 0, 0, 0}},
-        {{1, 2, 3, 6, 7, 0, 0, 0}},
-        {{0, 1, 2, 3, 6, 7, 0, 0}},
-        {{4, 6, 7, 0, 0, 0, 0, 0}},
-        {{0, 4, 6, 7, 0, 0, 0, 0}},
-        {{1, 4, 6, 7, 0, 0, 0, 0}},
-        {{0, 1, 4, 6, 7, 0, 0, 0}},
-        {{2, 4, 6, 7, 0, 0, 0, 0}},
-        {{0, 2, 4, 6, 7, 0, 0, 0}},
-        {{1, 2, 4, 6, 7, 0, 0, 0}},
-        {{0, 1, 2, 4, 6, 7, 0, 0}},
-        {{3, 4, 6, 7, 0, 0, 0, 0}},
-        {{0, 3, 4, 6, 7, 0, 0, 0}},
-        {{1, 3, 4, 6, 7, 0, 0, 0}},
-        {{0, 1, 3, 4, 6, 7, 0, 0}},
-        {{2, 3, 4, 6, 7, 0, 0, 0}},
-        {{0, 2, 3, 4, 6, 7, 0, 0}},
-        {{1, 2, 3, 4, 6, 7, 0, 0}},
-        {{0, 1, 2, 3, 4, 6, 7, 0}},
-        {{5, 6, 7, 0, 0, 0, 0, 0}},
-        {{0, 5, 6, 7, 0, 0, 0, 0}},
-        {{1, 5, 6, 7, 0, 0, 0, 0}},
-        {{0, 1, 5, 6, 7, 0, 0, 0}},
-        {{2, 5, 6, 7, 0, 0, 0, 0}},
-        {{0, 2, 5, 6, 7, 0, 0, 0}},
-        {{1, 2, 5, 6, 7, 0, 0, 0}},
-        {{0, 1, 2, 5, 6, 7, 0, 0}},
-        {{3, 5, 6, 7, 0, 0, 0, 0}},
-        {{0, 3, 5, 6, 7, 0, 0, 0}},
-        {{1, 3, 5, 6, 7, 0, 0, 0}},
-        {{0, 1, 3, 5, 6, 7, 0, 0}},
-        {{2, 3, 5, 6, 7, 0, 0, 0}},
-        {{0, 2, 3, 5, 6, 7, 0, 0}},
-        {{1, 2, 3, 5, 6, 7, 0, 0}},
-        {{0, 1, 2, 3, 5, 6, 7, 0}},
-        {{4, 5, 6, 7, 0, 0, 0, 0}},
-        {{0, 4, 5, 6, 7, 0, 0, 0}},
-        {{1, 4, 5, 6, 7, 0, 0, 0}},
-        {{0, 1, 4, 5, 6, 7, 0, 0}},
-        {{2, 4, 5, 6, 7, 0, 0, 0}},
-        {{0, 2, 4, 5, 6, 7, 0, 0}},
-        {{1, 2, 4, 5, 6, 7, 0, 0}},
-        {{0, 1, 2, 4, 5, 6, 7, 0}},
-        {{3, 4, 5, 6, 7, 0, 0, 0}},
-        {{0, 3, 4, 5, 6, 7, 0, 0}},
-        {{1, 3, 4, 5, 6, 7, 0, 0}},
-        {{0, 1, 3, 4, 5, 6, 7, 0}},
-        {{2, 3, 4, 5, 6, 7, 0, 0}},
-        {{0, 2, 3, 4, 5, 6, 7, 0}},
-        {{1, 2, 3, 4, 5, 6, 7, 0}},
-        {{0, 1, 2, 3, 4, 5, 6, 7}},
-    }};
+    // Operations work a word at a time. Since bit N is stored in byte N / 8, a little-endian load of 8 bytes gives a word in which bit N is at position N % 64, so the byte layout matches the word layout exactly.
+    static_assert(std::endian::native == std::endian::little);
+
+    // Gives a mask of the last word in which only excess bits are unset.
+    static t_u64 BitsetGetLastWordMask(const t_i32 bit_cnt) {
+        const t_i32 bits_in_last_word = bit_cnt % k_bitset_word_bit_cnt;
+        return bits_in_last_word == 0 ? ~0ull : (1ull << bits_in_last_word) - 1;
+    }
+
+    // Bytes past the end are read as 0, since the last word might be partial.
+    static t_u64 BitsetLoadWord(const t_array_rdonly<t_u8> bytes, const t_i32 word_index) {
+        const t_i32 byte_offs = word_index * 8;
+        ZCL_ASSERT(byte_offs >= 0 && byte_offs < bytes.len);
+
+        t_u64 word = 0;
+
+        if (bytes.len - byte_offs >= 8) {
+            memcpy(&word, bytes.raw + byte_offs, 8);
+        } else {
+            memcpy(&word, bytes.raw + byte_offs, static_cast<size_t>(bytes.len - byte_offs));
+        }
+
+        return word;
+    }
+
+    static void BitsetStoreWord(const t_array_mut<t_u8> bytes, const t_i32 word_index, const t_u64 word) {
+        const t_i32 byte_offs = word_index * 8;
+        ZCL_ASSERT(byte_offs >= 0 && byte_offs < bytes.len);
+
+        if (bytes.len - byte_offs >= 8) {
+            memcpy(bytes.raw + byte_offs, &word, 8);
+        } else {
+            memcpy(bytes.raw + byte_offs, &word, static_cast<size_t>(bytes.len - byte_offs));
+        }
+    }
+
+    // Loads the 64 bits beginning at an arbitrary bit index. Bits past the end of the bytes are read as 0.
+    static t_u64 BitsetLoadBitsAt(const t_array_rdonly<t_u8> bytes, const t_i32 bit_index) {
+        const t_i32 byte_offs = bit_index / 8;
+        const t_i32 shift = bit_index % 8;
+
+        t_u64 result = 0;
+        memcpy(&result, bytes.raw + byte_offs, static_cast<size_t>(CalcMin(bytes.len - byte_offs, 8)));
+        result >>= shift;
+
+        if (shift > 0 && byte_offs + 8 < bytes.len) {
+            result |= static_cast<t_u64>(bytes[byte_offs + 8]) << (k_bitset_word_bit_cnt - shift);
+        }
+
+        return result;
+    }
+
+    // Overwrites the given number of bits (1 to 64) beginning at an arbitrary bit index, leaving all surrounding bits as they were. The range must lie within the bytes.
+    static void BitsetStoreBitsAt(const t_array_mut<t_u8> bytes, const t_i32 bit_index, const t_u64 bits, const t_i32 bit_cnt) {
+        ZCL_ASSERT(bit_cnt >= 1 && bit_cnt <= k_bitset_word_bit_cnt);
+        ZCL_ASSERT(bit_index >= 0 && bit_index + bit_cnt <= bytes.len * 8);
+
+        const t_i32 byte_offs = bit_index / 8;
+        const t_i32 shift = bit_index % 8;
+        const t_u64 mask = bit_cnt == k_bitset_word_bit_cnt ? ~0ull : (1ull << bit_cnt) - 1;
+        const auto byte_cnt = static_cast<size_t>(CalcMin(bytes.len - byte_offs, 8));
+
+        t_u64 word = 0;
+        memcpy(&word, bytes.raw + byte_offs, byte_cnt);
+        word = (word & ~(mask << shift)) | ((bits & mask) << shift);
+        memcpy(bytes.raw + byte_offs, &word, byte_cnt);
+
+        // The range can spill into a ninth byte only when it isn't byte-aligned.
+        if (shift > 0 && shift + bit_cnt > k_bitset_word_bit_cnt) {
+            const auto spill_mask = static_cast<t_u8>(mask >> (k_bitset_word_bit_cnt - shift));
+            bytes[byte_offs + 8] = static_cast<t_u8>((bytes[byte_offs + 8] & ~spill_mask) | ((bits & mask) >> (k_bitset_word_bit_cnt - shift)));
+        }
+    }
+
+    static t_u64 BitsetReverseWord(t_u64 word) {
+        word = ((word >> 1) & 0x5555555555555555ull) | ((word & 0x5555555555555555ull) << 1);
+        word = ((word >> 2) & 0x3333333333333333ull) | ((word & 0x3333333333333333ull) << 2);
+        word = ((word >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((word & 0x0F0F0F0F0F0F0F0Full) << 4);
+        word = ((word >> 8) & 0x00FF00FF00FF00FFull) | ((word & 0x00FF00FF00FF00FFull) << 8);
+        word = ((word >> 16) & 0x0000FFFF0000FFFFull) | ((word & 0x0000FFFF0000FFFFull) << 16);
+        return (word >> 32) | (word << 32);
+    }
 
     t_b8 BitsetCheckAnySet(const t_bitset_rdonly bs) {
         if (bs.bit_cnt == 0) {
@@ -786,14 +93,15 @@ namespace zcl {
         }
 
         const auto bs_bytes = BitsetGetBytes(bs);
+        const t_i32 word_cnt = BitsetGetWordCount(bs.bit_cnt);
 
-        const auto first_bytes = ArraySlice(bs_bytes, 0, bs_bytes.len - 1);
-
-        if (!CheckAllEqual(first_bytes, 0)) {
-            return true;
+        for (t_i32 i = 0; i < word_cnt - 1; i++) {
+            if (BitsetLoadWord(bs_bytes, i) != 0) {
+                return true;
+            }
         }
 
-        return (bs_bytes[bs_bytes.len - 1] & BitsetGetLastByteMask(bs.bit_cnt)) != 0;
+        return (BitsetLoadWord(bs_bytes, word_cnt - 1) & BitsetGetLastWordMask(bs.bit_cnt)) != 0;
     }
 
     t_b8 BitsetCheckAllSet(const t_bitset_rdonly bs) {
@@ -802,15 +110,16 @@ namespace zcl {
         }
 
         const auto bs_bytes = BitsetGetBytes(bs);
+        const t_i32 word_cnt = BitsetGetWordCount(bs.bit_cnt);
 
-        const auto first_bytes = ArraySlice(bs_bytes, 0, bs_bytes.len - 1);
-
-        if (!CheckAllEqual(first_bytes, 0xFF)) {
-            return false;
+        for (t_i32 i = 0; i < word_cnt - 1; i++) {
+            if (BitsetLoadWord(bs_bytes, i) != ~0ull) {
+                return false;
+            }
         }
 
-        const auto last_byte_mask = BitsetGetLastByteMask(bs.bit_cnt);
-        return (bs_bytes[bs_bytes.len - 1] & last_byte_mask) == last_byte_mask;
+        const t_u64 last_word_mask = BitsetGetLastWordMask(bs.bit_cnt);
+        return (BitsetLoadWord(bs_bytes, word_cnt - 1) & last_word_mask) == last_word_mask;
     }
 
     void BitsetSetAll(const t_bitset_mut bs) {
@@ -843,20 +152,27 @@ namespace zcl {
         ZCL_ASSERT(begin_bit_index >= 0 && begin_bit_index < bs.bit_cnt);
         ZCL_ASSERT(end_bit_index >= begin_bit_index && end_bit_index <= bs.bit_cnt);
 
+        if (begin_bit_index == end_bit_index) {
+            return;
+        }
+
         const auto bs_bytes = BitsetGetBytes(bs);
 
-        const t_i32 begin_elem_index = begin_bit_index / 8;
-        const t_i32 end_elem_index = BitsToBytes(end_bit_index);
+        const t_i32 begin_word_index = begin_bit_index / k_bitset_word_bit_cnt;
+        const t_i32 last_word_index = (end_bit_index - 1) / k_bitset_word_bit_cnt;
+
+        for (t_i32 i = begin_word_index; i <= last_word_index; i++) {
+            t_u64 mask = ~0ull;
 
-        for (t_i32 i = begin_elem_index; i < end_elem_index; i++) {
-            const t_i32 bit_offs = i * 8;
-            const t_i32 begin_bit_index_rel = begin_bit_index - bit_offs;
-            const t_i32 end_bit_index_rel = end_bit_index - bit_offs;
+            if (i == begin_word_index) {
+                mask &= ~0ull << (begin_bit_index % k_bitset_word_bit_cnt);
+            }
 
-            const t_i32 set_range_begin = CalcMax(begin_bit_index_rel, 0);
-            const t_i32 set_range_end = CalcMin(end_bit_index_rel, 8);
+            if (i == last_word_index) {
+                mask &= BitsetGetLastWordMask(end_bit_index);
+            }
 
-            bs_bytes[i] |= ByteBitmaskCreateRange(set_range_begin, set_range_end);
+            BitsetStoreWord(bs_bytes, i, BitsetLoadWord(bs_bytes, i) | mask);
         }
     }
 
@@ -868,35 +184,37 @@ namespace zcl {
         }
 
         const auto bs_bytes = BitsetGetBytes(bs);
+        const auto mask_bytes = BitsetGetBytes(mask);
+        const t_i32 word_cnt = BitsetGetWordCount(bs.bit_cnt);
 
         switch (op) {
             case ek_bitwise_mask_op_and: {
-                for (t_i32 i = 0; i < bs_bytes.len; i++) {
-                    bs_bytes[i] &= BitsetGetBytes(mask)[i];
+                for (t_i32 i = 0; i < word_cnt; i++) {
+                    BitsetStoreWord(bs_bytes, i, BitsetLoadWord(bs_bytes, i) & BitsetLoadWord(mask_bytes, i));
                 }
 
                 break;
             }
 
             case ek_bitwise_mask_op_or: {
-                for (t_i32 i = 0; i < bs_bytes.len; i++) {
-                    bs_bytes[i] |= BitsetGetBytes(mask)[i];
+                for (t_i32 i = 0; i < word_cnt; i++) {
+                    BitsetStoreWord(bs_bytes, i, BitsetLoadWord(bs_bytes, i) | BitsetLoadWord(mask_bytes, i));
                 }
 
                 break;
             }
 
             case ek_bitwise_mask_op_xor: {
-                for (t_i32 i = 0; i < bs_bytes.len; i++) {
-                    bs_bytes[i] ^= BitsetGetBytes(mask)[i];
+                for (t_i32 i = 0; i < word_cnt; i++) {
+                    BitsetStoreWord(bs_bytes, i, BitsetLoadWord(bs_bytes, i) ^ BitsetLoadWord(mask_bytes, i));
                 }
 
                 break;
             }
 
             case ek_bitwise_mask_op_andnot: {
-                for (t_i32 i = 0; i < bs_bytes.len; i++) {
-                    bs_bytes[i] &= ~BitsetGetBytes(mask)[i];
+                for (t_i32 i = 0; i < word_cnt; i++) {
+                    BitsetStoreWord(bs_bytes, i, BitsetLoadWord(bs_bytes, i) & ~BitsetLoadWord(mask_bytes, i));
                 }
 
                 break;
@@ -906,91 +224,132 @@ namespace zcl {
         bs_bytes[bs_bytes.len - 1] &= BitsetGetLastByteMask(bs.bit_cnt);
     }
 
-    static t_u8 BitsetShiftLeftSingle(const t_bitset_mut bs) {
-        if (bs.bit_cnt == 0) {
-            return 0;
+    void BitsetShiftLeft(const t_bitset_mut bs, const t_i32 amount) {
+        ZCL_ASSERT(amount >= 0);
+
+        if (bs.bit_cnt == 0 || amount == 0) {
+            return;
         }
 
         const auto bs_bytes = BitsetGetBytes(bs);
 
-        t_u8 discard = 0;
-
-        for (t_i32 i = 0; i < bs_bytes.len; i++) {
-            const t_i32 bits_in_byte = i == bs_bytes.len - 1 ? BitsetGetLastByteBitCount(bs.bit_cnt) : 8;
-            const t_u8 discard_last = discard;
-            discard = (bs_bytes[i] & ByteBitmaskCreateSingle(bits_in_byte - 1)) >> (bits_in_byte - 1);
-            bs_bytes[i] <<= 1;
-            bs_bytes[i] |= discard_last;
+        if (amount >= bs.bit_cnt) {
+            SetAllTo(bs_bytes, 0);
+            return;
         }
 
-        bs_bytes[bs_bytes.len - 1] &= BitsetGetLastByteMask(bs.bit_cnt);
+        const t_i32 word_cnt = BitsetGetWordCount(bs.bit_cnt);
+        const t_i32 word_shift = amount / k_bitset_word_bit_cnt;
+        const t_i32 bit_shift = amount % k_bitset_word_bit_cnt;
 
-        return discard;
-    }
+        // Going from the top down means that every source word is read before it gets overwritten.
+        for (t_i32 i = word_cnt - 1; i >= 0; i--) {
+            const t_i32 src_index = i - word_shift;
 
-    void BitsetShiftLeft(const t_bitset_mut bs, const t_i32 amount) {
-        ZCL_ASSERT(amount >= 0);
+            t_u64 word = 0;
 
-        // @speed: :(
+            if (src_index >= 0) {
+                word = BitsetLoadWord(bs_bytes, src_index) << bit_shift;
+
+                if (bit_shift > 0 && src_index > 0) {
+                    word |= BitsetLoadWord(bs_bytes, src_index - 1) >> (k_bitset_word_bit_cnt - bit_shift);
+                }
+            }
 
-        for (t_i32 i = 0; i < amount; i++) {
-            BitsetShiftLeftSingle(bs);
+            BitsetStoreWord(bs_bytes, i, word);
         }
+
+        bs_bytes[bs_bytes.len - 1] &= BitsetGetLastByteMask(bs.bit_cnt);
     }
 
-    void BitsetRotateLeft(const t_bitset_mut bs, const t_i32 amount) {
+    void BitsetShiftRight(const t_bitset_mut bs, const t_i32 amount) {
         ZCL_ASSERT(amount >= 0);
 
-        if (bs.bit_cnt == 0) {
+        if (bs.bit_cnt == 0 || amount == 0) {
+            return;
+        }
+
+        const auto bs_bytes = BitsetGetBytes(bs);
+
+        if (amount >= bs.bit_cnt) {
+            SetAllTo(bs_bytes, 0);
             return;
         }
 
-        // @speed: :(
+        bs_bytes[bs_bytes.len - 1] &= BitsetGetLastByteMask(bs.bit_cnt); // Drop any excess bits so we don't accidentally shift a 1 in.
+
+        const t_i32 word_cnt = BitsetGetWordCount(bs.bit_cnt);
+        const t_i32 word_shift = amount / k_bitset_word_bit_cnt;
+        const t_i32 bit_shift = amount % k_bitset_word_bit_cnt;
+
+        // Going from the bottom up means that every source word is read before it gets overwritten.
+        for (t_i32 i = 0; i < word_cnt; i++) {
+            const t_i32 src_index = i + word_shift;
+
+            t_u64 word = 0;
 
-        for (t_i32 i = 0; i < amount; i++) {
-            const auto discard = BitsetShiftLeftSingle(bs);
+            if (src_index < word_cnt) {
+                word = BitsetLoadWord(bs_bytes, src_index) >> bit_shift;
 
-            if (discard) {
-                BitsetSet(bs, 0);
-            } else {
-                BitsetUnset(bs, 0);
+                if (bit_shift > 0 && src_index + 1 < word_cnt) {
+                    word |= BitsetLoadWord(bs_bytes, src_index + 1) << (k_bitset_word_bit_cnt - bit_shift);
+                }
             }
-        }
-    }
 
-    static t_u8 BitsetShiftRightSingle(const t_bitset_mut bs) {
-        if (bs.bit_cnt == 0) {
-            return 0;
+            BitsetStoreWord(bs_bytes, i, word);
         }
+    }
 
-        const auto bs_bytes = BitsetGetBytes(bs);
+    // Reverses the order of the bits in the range [begin, end), swapping a word from each end at a time.
+    static void BitsetReverseRange(const t_array_mut<t_u8> bytes, t_i32 begin, t_i32 end) {
+        while (end - begin >= 2 * k_bitset_word_bit_cnt) {
+            const t_u64 front = BitsetLoadBitsAt(bytes, begin);
+            const t_u64 back = BitsetLoadBitsAt(bytes, end - k_bitset_word_bit_cnt);
 
-        bs_bytes[bs_bytes.len - 1] &= BitsetGetLastByteMask(bs.bit_cnt); // Drop any excess bits so we don't accidentally shift a 1 in.
+            BitsetStoreBitsAt(bytes, begin, BitsetReverseWord(back), k_bitset_word_bit_cnt);
+            BitsetStoreBitsAt(bytes, end - k_bitset_word_bit_cnt, BitsetReverseWord(front), k_bitset_word_bit_cnt);
 
-        t_u8 discard = 0;
+            begin += k_bitset_word_bit_cnt;
+            end -= k_bitset_word_bit_cnt;
+        }
 
-        for (t_i32 i = bs_bytes.len - 1; i >= 0; i--) {
-            const t_i32 bits_in_byte = i == bs_bytes.len - 1 ? BitsetGetLastByteBitCount(bs.bit_cnt) : 8;
-            const t_u8 discard_last = discard;
-            discard = bs_bytes[i] & ByteBitmaskCreateSingle(0);
-            bs_bytes[i] >>= 1;
+        // Fewer than two words remain, so swap the two halves as partial words. Any middle bit stays put.
+        const t_i32 half_bit_cnt = (end - begin) / 2;
 
-            if (discard_last) {
-                bs_bytes[i] |= ByteBitmaskCreateSingle(bits_in_byte - 1);
-            }
+        if (half_bit_cnt == 0) {
+            return;
         }
 
-        return discard;
+        const t_u64 front = BitsetLoadBitsAt(bytes, begin);
+        const t_u64 back = BitsetLoadBitsAt(bytes, end - half_bit_cnt);
+
+        // Reversing the whole word moves the low bits of interest to the top, hence the shift back down.
+        BitsetStoreBitsAt(bytes, begin, BitsetReverseWord(back) >> (k_bitset_word_bit_cnt - half_bit_cnt), half_bit_cnt);
+        BitsetStoreBitsAt(bytes, end - half_bit_cnt, BitsetReverseWord(front) >> (k_bitset_word_bit_cnt - half_bit_cnt), half_bit_cnt);
     }
 
-    void BitsetShiftRight(const t_bitset_mut bs, const t_i32 amount) {
-        ZCL_ASSERT(amount >= 0);
+    // Rotates in place by reversing the whole bitset and then each of the two pieces, which costs the same for every amount and needs no carry buffer.
+    static void BitsetRotate(const t_bitset_mut bs, const t_i32 amount_left) {
+        if (bs.bit_cnt == 0) {
+            return;
+        }
 
-        // @speed: :(
+        const t_i32 amount = amount_left % bs.bit_cnt;
 
-        for (t_i32 i = 0; i < amount; i++) {
-            BitsetShiftRightSingle(bs);
+        if (amount == 0) {
+            return;
         }
+
+        const auto bs_bytes = BitsetGetBytes(bs);
+
+        BitsetReverseRange(bs_bytes, 0, bs.bit_cnt);
+        BitsetReverseRange(bs_bytes, 0, amount);
+        BitsetReverseRange(bs_bytes, amount, bs.bit_cnt);
+    }
+
+    void BitsetRotateLeft(const t_bitset_mut bs, const t_i32 amount) {
+        ZCL_ASSERT(amount >= 0);
+        BitsetRotate(bs, amount);
     }
 
     void BitsetRotateRight(const t_bitset_mut bs, const t_i32 amount) {
@@ -1000,43 +359,32 @@ namespace zcl {
             return;
         }
 
-        // @speed: :(
-
-        for (t_i32 i = 0; i < amount; i++) {
-            const auto discard = BitsetShiftRightSingle(bs);
-
-            if (discard) {
-                BitsetSet(bs, bs.bit_cnt - 1);
-            } else {
-                BitsetUnset(bs, bs.bit_cnt - 1);
-            }
-        }
+        BitsetRotate(bs, bs.bit_cnt - (amount % bs.bit_cnt));
     }
 
     // ============================================================
 
-    static t_i32 BitsetFindFirstSetBitHelper(const t_bitset_rdonly bs, const t_i32 from, const t_u8 xor_mask) {
+    static t_i32 BitsetFindFirstSetBitHelper(const t_bitset_rdonly bs, const t_i32 from, const t_u64 xor_mask) {
         ZCL_ASSERT(from >= 0 && from <= bs.bit_cnt); // Intentionally allowing the upper bound here for the case of iteration.
 
         const auto bs_bytes = BitsetGetBytes(bs);
 
-        const t_i32 begin_byte_index = from / 8;
+        const t_i32 word_cnt = BitsetGetWordCount(bs.bit_cnt);
+        const t_i32 begin_word_index = from / k_bitset_word_bit_cnt;
 
-        for (t_i32 i = begin_byte_index; i < bs_bytes.len; i++) {
-            t_u8 byte = bs_bytes[i] ^ xor_mask;
+        for (t_i32 i = begin_word_index; i < word_cnt; i++) {
+            t_u64 word = BitsetLoadWord(bs_bytes, i) ^ xor_mask;
 
-            if (i == begin_byte_index) {
-                byte &= ByteBitmaskCreateRange(from % 8);
+            if (i == begin_word_index) {
+                word &= ~0ull << (from % k_bitset_word_bit_cnt);
             }
 
-            if (i == bs_bytes.len - 1) {
-                byte &= BitsetGetLastByteMask(bs.bit_cnt);
+            if (i == word_cnt - 1) {
+                word &= BitsetGetLastWordMask(bs.bit_cnt);
             }
 
-            const t_i32 bi = k_byte_indexes_of_first_set_bit[byte];
-
-            if (bi != -1) {
-                return (8 * i) + bi;
+            if (word != 0) {
+                return (k_bitset_word_bit_cnt * i) + std::countr_zero(word);
             }
         }
 
@@ -1048,7 +396,7 @@ namespace zcl {
     }
 
     t_i32 BitsetFindFirstUnset(const t_bitset_rdonly bs, const t_i32 from) {
-        return BitsetFindFirstSetBitHelper(bs, from, 0xFF);
+        return BitsetFindFirstSetBitHelper(bs, from, ~0ull);
     }
 
     t_i32 BitsetCountSet(const t_bitset_rdonly bs) {
@@ -1056,12 +404,13 @@ namespace zcl {
 
         if (bs.bit_cnt > 0) {
             const auto bs_bytes = BitsetGetBytes(bs);
+            const t_i32 word_cnt = BitsetGetWordCount(bs.bit_cnt);
 
-            for (t_i32 i = 0; i < bs_bytes.len - 1; i++) {
-                result += k_byte_set_bit_counts[bs_bytes[i]];
+            for (t_i32 i = 0; i < word_cnt - 1; i++) {
+                result += std::popcount(BitsetLoadWord(bs_bytes, i));
             }
 
-            result += k_byte_set_bit_counts[bs_bytes[bs_bytes.len - 1] & BitsetGetLastByteMask(bs.bit_cnt)];
+            result += std::popcount(BitsetLoadWord(bs_bytes, word_cnt - 1) & BitsetGetLastWordMask(bs.bit_cnt));
         }
 
         return result;
@@ -1074,32 +423,159 @@ namespace zcl {
 
         if (bs.bit_cnt > 0) {
             const auto bs_bytes = BitsetGetBytes(bs);
+            const t_i32 word_cnt = BitsetGetWordCount(bs.bit_cnt);
 
-            {
-                t_i32 result_index = 0;
+            t_i32 result_index = 0;
 
-                for (t_i32 i = 0; i < bs_bytes.len - 1; i++) {
-                    const auto set_bit_cnt = k_byte_set_bit_counts[bs_bytes[i]];
+            for (t_i32 i = 0; i < word_cnt; i++) {
+                t_u64 word = BitsetLoadWord(bs_bytes, i);
 
-                    for (t_i32 j = 0; j < set_bit_cnt; j++) {
-                        result[result_index] = (8 * i) + k_byte_set_bit_indexes[bs_bytes[i]][j];
-                        result_index++;
-                    }
+                if (i == word_cnt - 1) {
+                    word &= BitsetGetLastWordMask(bs.bit_cnt);
                 }
 
-                {
-                    const auto byte_last = bs_bytes[bs_bytes.len - 1] & BitsetGetLastByteMask(bs.bit_cnt);
-
-                    const auto byte_last_set_bit_cnt = k_byte_set_bit_counts[byte_last];
+                while (word != 0) {
+                    result[result_index] = (k_bitset_word_bit_cnt * i) + std::countr_zero(word);
+                    result_index++;
 
-                    for (t_i32 j = 0; j < byte_last_set_bit_cnt; j++) {
-                        result[result_index] = (8 * (bs_bytes.len - 1)) + k_byte_set_bit_indexes[byte_last][j];
-                        result_index++;
-                    }
+                    word &= word - 1; // Clear the lowest set bit.
                 }
             }
         }
 
         return result;
     }
+
+    t_b8 BitsetWalk(t_bitset_walker *const walker, t_i32 *const o_index) {
+        const t_i32 word_cnt = BitsetGetWordCount(walker->bs.bit_cnt);
+
+        while (walker->word == 0) {
+            if (walker->word_index + 1 >= word_cnt) {
+                walker->word_index = word_cnt;
+                return false;
+            }
+
+            walker->word_index++;
+
+            t_u64 word = BitsetLoadWord(BitsetGetBytes(walker->bs), walker->word_index);
+
+            for (t_i32 i = 0; i < walker->and_masks.len && word != 0; i++) {
+                word &= BitsetLoadWord(BitsetGetBytes(walker->and_masks[i]), walker->word_index);
+            }
+
+            for (t_i32 i = 0; i < walker->andnot_masks.len && word != 0; i++) {
+                word &= ~BitsetLoadWord(BitsetGetBytes(walker->andnot_masks[i]), walker->word_index);
+            }
+
+            if (walker->word_index == word_cnt - 1) {
+                word &= BitsetGetLastWordMask(walker->bs.bit_cnt);
+            }
+
+            walker->word = word;
+        }
+
+        *o_index = (k_bitset_word_bit_cnt * walker->word_index) + std::countr_zero(walker->word);
+        walker->word &= walker->word - 1;
+
+        return true;
+    }
+
+    // ============================================================
+    // @section: Hierarchical Bitsets
+
+    // Loads a word of the main bitset, with any excess bits of the last word masked out.
+    static t_u64 HierarchicalBitsetLoadWord(const t_hierarchical_bitset_rdonly hbs, const t_i32 word_index) {
+        t_u64 word = BitsetLoadWord(BitsetGetBytes(hbs.bits), word_index);
+
+        if (word_index == hbs.summary.bit_cnt - 1) {
+            word &= BitsetGetLastWordMask(hbs.bits.bit_cnt);
+        }
+
+        return word;
+    }
+
+    void HierarchicalBitsetUnset(const t_hierarchical_bitset_mut hbs, const t_i32 index) {
+        BitsetUnset(hbs.bits, index);
+
+        const t_i32 word_index = index / k_bitset_word_bit_cnt;
+
+        if (HierarchicalBitsetLoadWord(hbs, word_index) == 0) {
+            BitsetUnset(hbs.summary, word_index);
+        }
+    }
+
+    void HierarchicalBitsetUnsetAll(const t_hierarchical_bitset_mut hbs) {
+        const auto bits_bytes = BitsetGetBytes(hbs.bits);
+
+        ZCL_BITSET_WALK_SET(hbs.summary, word_index) {
+            BitsetStoreWord(bits_bytes, word_index, 0);
+        }
+
+        BitsetUnsetAll(hbs.summary);
+    }
+
+    t_i32 HierarchicalBitsetFindFirstSet(const t_hierarchical_bitset_rdonly hbs, const t_i32 from) {
+        ZCL_ASSERT(from >= 0 && from <= hbs.bits.bit_cnt); // Intentionally allowing the upper bound here for the case of iteration.
+
+        if (from == hbs.bits.bit_cnt) {
+            return -1;
+        }
+
+        // Check the rest of the word the search begins in.
+        const t_i32 begin_word_index = from / k_bitset_word_bit_cnt;
+        const t_u64 begin_word = HierarchicalBitsetLoadWord(hbs, begin_word_index) & (~0ull << (from % k_bitset_word_bit_cnt));
+
+        if (begin_word != 0) {
+            return (k_bitset_word_bit_cnt * begin_word_index) + std::countr_zero(begin_word);
+        }
+
+        // Then jump straight to the next non-empty word.
+        const t_i32 word_index = BitsetFindFirstSet(hbs.summary, begin_word_index + 1);
+
+        if (word_index == -1) {
+            return -1;
+        }
+
+        return (k_bitset_word_bit_cnt * word_index) + std::countr_zero(HierarchicalBitsetLoadWord(hbs, word_index));
+    }
+
+    t_i32 HierarchicalBitsetCountSet(const t_hierarchical_bitset_rdonly hbs) {
+        t_i32 result = 0;
+
+        ZCL_BITSET_WALK_SET(hbs.summary, word_index) {
+            result += std::popcount(HierarchicalBitsetLoadWord(hbs, word_index));
+        }
+
+        return result;
+    }
+
+    t_array_mut<t_i32> HierarchicalBitsetLoadIndexesOfSet(const t_hierarchical_bitset_rdonly hbs, t_arena *const arena) {
+        const auto result = ArenaPushArray<t_i32>(arena, HierarchicalBitsetCountSet(hbs));
+        t_i32 result_index = 0;
+
+        ZCL_HIERARCHICAL_BITSET_WALK_SET(hbs, index) {
+            result[result_index] = index;
+            result_index++;
+        }
+
+        return result;
+    }
+
+    t_b8 HierarchicalBitsetWalk(t_hierarchical_bitset_walker *const walker, t_i32 *const o_index) {
+        while (walker->word == 0) {
+            if (!BitsetWalk(&walker->summary_walker, &walker->word_index)) {
+                walker->word_index = -1;
+                return false;
+            }
+
+            walker->word = HierarchicalBitsetLoadWord({walker->bits, walker->summary_walker.bs}, walker->word_index);
+        }
+
+        *o_index = (k_bitset_word_bit_cnt * walker->word_index) + std::countr_zero(walker->word);
+        walker->word &= walker->word - 1;
+
+        return true;
+    }
+
+    // ==================================================
 }
@@ -0,0 +1,186 @@
+#include <zcl/zcl_file_loading.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <zcl/zcl_file_sys.h>
+#include <zcl/zcl_rings.h>
+
+namespace zcl {
+    struct t_file_load_slot {
+        // These are written by the owning thread on submission.
+        t_static_array<t_u8, k_file_load_path_len_limit> path_bytes;
+        t_i32 path_len;
+        t_arena *contents_arena;
+        t_b8 add_terminator;
+        void *user_data;
+
+        // These are written by a worker once loaded.
+        t_b8 success;
+        t_array_mut<t_u8> contents;
+    };
+
+    struct t_file_loader {
+        // A request lives in a slot from submission until it's polled. Slot indexes are what get passed through the rings, with the rings' release/acquire ordering making each side's writes to the slot visible to the other.
+        t_array_mut<t_file_load_slot> slots;
+
+        // These are only touched by the owning thread.
+        t_array_mut<t_i32> free_slot_indexes;
+        t_i32 free_slot_cnt;
+
+        t_mpmc_ring<t_i32> *pending_ring; // Owning thread to workers.
+        t_mpmc_ring<t_i32> *completed_ring; // Workers to owning thread. Neither ring can fill up since there are only as many slots as ring cells.
+
+        std::thread *workers;
+        t_arena **worker_temp_arenas;
+        t_i32 worker_cnt;
+
+        std::mutex mutex;
+        std::condition_variable pending_cond; // Signalled to workers when a request is submitted or the loader is shutting down.
+
+        // These are protected by the mutex.
+        t_i32 pending_cnt; // How many requests are in the pending ring without a worker having claimed them.
+        t_b8 shutting_down;
+    };
+
+    static void FileLoaderWorkerLoop(t_file_loader *const loader, t_arena *const temp_arena) {
+        while (true) {
+            {
+                std::unique_lock lock(loader->mutex);
+
+                loader->pending_cond.wait(lock, [loader]() {
+                    return loader->shutting_down || loader->pending_cnt > 0;
+                });
+
+                // Anything still pending gets loaded before shutting down.
+                if (loader->pending_cnt == 0) {
+                    return;
+                }
+
+                loader->pending_cnt--;
+            }
+
+            // The request was pushed before the count was incremented, and pushes only come from the one thread, so this can't come up empty.
+            t_i32 slot_index;
+            ZCL_REQUIRE(MPMCRingPop(loader->pending_ring, &slot_index));
+
+            t_file_load_slot *const slot = &loader->slots[slot_index];
+
+            const t_str_rdonly path = {ArraySlice(ArrayToNonstatic(&slot->path_bytes), 0, slot->path_len)};
+
+            slot->success = FileLoadContents(path, slot->contents_arena, temp_arena, &slot->contents, slot->add_terminator);
+
+            if (!slot->success) {
+                slot->contents = {};
+            }
+
+            ArenaRewind(temp_arena);
+
+            ZCL_REQUIRE(MPMCRingPush(loader->completed_ring, slot_index));
+        }
+    }
+
+    t_file_loader *FileLoaderCreate(const t_i32 worker_cnt, const t_i32 request_cap, t_arena *const arena) {
+        ZCL_ASSERT(worker_cnt > 0);
+
+        const auto loader = new (ArenaPushRaw(arena, ZCL_SIZE_OF(t_file_loader), ZCL_ALIGN_OF(t_file_loader))) t_file_loader();
+
+        loader->slots = ArenaPushArray<t_file_load_slot>(arena, request_cap);
+
+        loader->free_slot_indexes = ArenaPushArray<t_i32>(arena, request_cap);
+        loader->free_slot_cnt = request_cap;
+
+        for (t_i32 i = 0; i < request_cap; i++) {
+            loader->free_slot_indexes[i] = i;
+        }
+
+        loader->pending_ring = MPMCRingCreate<t_i32>(request_cap, arena);
+        loader->completed_ring = MPMCRingCreate<t_i32>(request_cap, arena);
+
+        loader->worker_cnt = worker_cnt;
+        loader->workers = static_cast<std::thread *>(ArenaPushRaw(arena, ZCL_SIZE_OF(std::thread) * worker_cnt, ZCL_ALIGN_OF(std::thread)));
+        loader->worker_temp_arenas = ArenaPushArray<t_arena *>(arena, worker_cnt).raw;
+
+        for (t_i32 i = 0; i < worker_cnt; i++) {
+            loader->worker_temp_arenas[i] = ArenaCreateBlockBased();
+            new (&loader->workers[i]) std::thread(FileLoaderWorkerLoop, loader, loader->worker_temp_arenas[i]);
+        }
+
+        return loader;
+    }
+
+    void FileLoaderDestroy(t_file_loader *const loader) {
+        {
+            const std::lock_guard lock(loader->mutex);
+            loader->shutting_down = true;
+        }
+
+        loader->pending_cond.notify_all();
+
+        for (t_i32 i = 0; i < loader->worker_cnt; i++) {
+            loader->workers[i].join();
+            loader->workers[i].~thread();
+
+            ArenaDestroy(loader->worker_temp_arenas[i]);
+        }
+
+        loader->~t_file_loader();
+    }
+
+    t_b8 FileLoaderSubmit(t_file_loader *const loader, const t_file_load_request &request) {
+        ZCL_ASSERT(request.path.bytes.len <= k_file_load_path_len_limit);
+        ZCL_ASSERT(request.contents_arena);
+
+        if (loader->free_slot_cnt == 0) {
+            return false;
+        }
+
+        loader->free_slot_cnt--;
+        const t_i32 slot_index = loader->free_slot_indexes[loader->free_slot_cnt];
+
+        t_file_load_slot *const slot = &loader->slots[slot_index];
+
+        ArrayCopy(request.path.bytes, ArrayToNonstatic(&slot->path_bytes));
+        slot->path_len = request.path.bytes.len;
+        slot->contents_arena = request.contents_arena;
+        slot->add_terminator = request.add_terminator;
+        slot->user_data = request.user_data;
+
+        ZCL_REQUIRE(MPMCRingPush(loader->pending_ring, slot_index));
+
+        {
+            const std::lock_guard lock(loader->mutex);
+            loader->pending_cnt++;
+        }
+
+        loader->pending_cond.notify_one();
+
+        return true;
+    }
+
+    t_b8 FileLoaderPoll(t_file_loader *const loader, t_file_load_completion *const o_completion) {
+        t_i32 slot_index;
+
+        if (!MPMCRingPop(loader->completed_ring, &slot_index)) {
+            return false;
+        }
+
+        const t_file_load_slot *const slot = &loader->slots[slot_index];
+
+        *o_completion = {
+            .user_data = slot->user_data,
+            .success = slot->success,
+            .contents = slot->contents,
+        };
+
+        loader->free_slot_indexes[loader->free_slot_cnt] = slot_index;
+        loader->free_slot_cnt++;
+
+        return true;
+    }
+
+    t_i32 FileLoaderGetOutstandingCount(const t_file_loader *const loader) {
+        return loader->slots.len - loader->free_slot_cnt;
+    }
+}
@@ -3,6 +3,11 @@
 #ifdef ZCL_PLATFORM_WINDOWS
     #include <windows.h>
     #include <direct.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
 #endif
 
 namespace zcl {
@@ -136,6 +141,10 @@ namespace zcl {
 #endif
     }
 
+    static t_b8 FileWriteRaw(FILE *const file_raw, const t_array_rdonly<t_u8> bytes) {
+        return static_cast<t_i32>(fwrite(bytes.raw, 1, static_cast<size_t>(bytes.len), file_raw)) == bytes.len;
+    }
+
     t_stream_view FileStreamGetView(t_file_stream *const stream) {
         ZCL_ASSERT(stream->open);
 
@@ -150,17 +159,82 @@ namespace zcl {
             ZCL_ASSERT(stream_view.mode == ek_stream_mode_write);
 
             const auto state = static_cast<t_file_stream *>(stream_view.data);
-            return static_cast<t_i32>(fwrite(src_bytes.raw, 1, static_cast<size_t>(src_bytes.len), state->file_raw)) == src_bytes.len;
+
+            if (state->write_buf_len + src_bytes.len <= state->write_buf.len) {
+                ArrayCopy(src_bytes, ArraySliceFrom(state->write_buf, state->write_buf_len));
+                state->write_buf_len += src_bytes.len;
+                return true;
+            }
+
+            if (!FileStreamFlushWriteBuffer(state)) {
+                return false;
+            }
+
+            if (src_bytes.len < state->write_buf.len) {
+                ArrayCopy(src_bytes, state->write_buf);
+                state->write_buf_len = src_bytes.len;
+                return true;
+            }
+
+            return FileWriteRaw(state->file_raw, src_bytes);
+        };
+
+        const auto reserve_func = [](const t_stream_view stream_view, const t_i32 size) -> t_array_mut<t_u8> {
+            const auto state = static_cast<t_file_stream *>(stream_view.data);
+
+            if (size > state->write_buf.len) {
+                return {};
+            }
+
+            if (state->write_buf_len + size > state->write_buf.len) {
+                if (!FileStreamFlushWriteBuffer(state)) {
+                    return {};
+                }
+            }
+
+            return ArraySlice(state->write_buf, state->write_buf_len, state->write_buf_len + size);
+        };
+
+        const auto commit_func = [](const t_stream_view stream_view, const t_i32 size) {
+            const auto state = static_cast<t_file_stream *>(stream_view.data);
+
+            ZCL_ASSERT(state->write_buf_len + size <= state->write_buf.len);
+            state->write_buf_len += size;
         };
 
         return {
             .data = stream,
             .read_func = read_func,
             .write_func = write_func,
+            .reserve_func = stream->write_buf.len > 0 ? +reserve_func : nullptr,
+            .commit_func = stream->write_buf.len > 0 ? +commit_func : nullptr,
             .mode = stream->mode,
         };
     }
 
+    void FileStreamSetWriteBuffer(t_file_stream *const stream, const t_array_mut<t_u8> buf) {
+        ZCL_ASSERT(stream->open);
+        ZCL_ASSERT(stream->mode == ek_stream_mode_write);
+
+        static_cast<void>(FileStreamFlushWriteBuffer(stream));
+
+        stream->write_buf = buf;
+        stream->write_buf_len = 0;
+    }
+
+    t_b8 FileStreamFlushWriteBuffer(t_file_stream *const stream) {
+        ZCL_ASSERT(stream->open);
+
+        if (stream->write_buf_len == 0) {
+            return true;
+        }
+
+        const t_array_rdonly<t_u8> pending = ArraySlice(stream->write_buf, 0, stream->write_buf_len);
+        stream->write_buf_len = 0;
+
+        return FileWriteRaw(stream->file_raw, pending);
+    }
+
     t_b8 FileCreate(const t_str_rdonly path, t_arena *const temp_arena) {
         t_file_stream stream;
 
@@ -254,6 +328,8 @@ namespace zcl {
     }
 
     t_b8 FileReopen(t_file_stream *const stream_current, const t_str_rdonly path, const t_file_access_mode mode, t_arena *const temp_arena, t_file_stream *const o_stream_new) {
+        static_cast<void>(FileStreamFlushWriteBuffer(stream_current));
+
         const t_str_rdonly path_terminated = StrCloneButAddTerminator(path, temp_arena);
 
         const auto file = [mode, path_terminated, stream_current]() -> FILE * {
@@ -288,6 +364,8 @@ namespace zcl {
     void FileClose(t_file_stream *const stream) {
         ZCL_ASSERT(stream->open);
 
+        static_cast<void>(FileStreamFlushWriteBuffer(stream));
+
         fclose(stream->file_raw);
 
         *stream = {
@@ -299,12 +377,16 @@ namespace zcl {
         ZCL_ASSERT(stream->open);
         ZCL_ASSERT(stream->mode == ek_stream_mode_write);
 
+        static_cast<void>(FileStreamFlushWriteBuffer(stream));
+
         fflush(stream->file_raw);
     }
 
     t_i32 FileCalcSize(t_file_stream *const stream) {
         ZCL_ASSERT(stream->open);
 
+        static_cast<void>(FileStreamFlushWriteBuffer(stream)); // Pending writes count towards the size.
+
         const auto pos_old = ftell(stream->file_raw);
         fseek(stream->file_raw, 0, SEEK_END);
         const auto file_size = ftell(stream->file_raw);
@@ -336,4 +418,99 @@ namespace zcl {
 
         return true;
     }
+
+    t_b8 FileMap(const t_str_rdonly path, t_arena *const temp_arena, t_mapped_file *const o_mapped_file) {
+        const t_str_rdonly path_terminated = StrCloneButAddTerminator(path, temp_arena);
+
+#if defined(ZCL_PLATFORM_WINDOWS)
+        const HANDLE file = CreateFileA(StrToCStr(path_terminated), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        ZCL_DEFER({ CloseHandle(file); });
+
+        LARGE_INTEGER file_size;
+
+        if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart > k_i32_max) {
+            return false;
+        }
+
+        if (file_size.QuadPart == 0) {
+            // Empty files can't be mapped.
+            *o_mapped_file = {};
+            return true;
+        }
+
+        // The view keeps its own reference to the mapping, so the handles can be closed as soon as it exists.
+        const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (!mapping) {
+            return false;
+        }
+
+        ZCL_DEFER({ CloseHandle(mapping); });
+
+        const void *const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+        if (!view) {
+            return false;
+        }
+
+        *o_mapped_file = {
+            .contents = {static_cast<const t_u8 *>(view), static_cast<t_i32>(file_size.QuadPart)},
+        };
+
+        return true;
+#elif defined(ZCL_PLATFORM_MACOS) || defined(ZCL_PLATFORM_LINUX)
+        const int file = open(StrToCStr(path_terminated), O_RDONLY);
+
+        if (file == -1) {
+            return false;
+        }
+
+        ZCL_DEFER({ close(file); }); // The mapping stays valid after the descriptor is closed.
+
+        struct stat info;
+
+        if (fstat(file, &info) != 0 || info.st_size > k_i32_max) {
+            return false;
+        }
+
+        if (info.st_size == 0) {
+            // Empty files can't be mapped.
+            *o_mapped_file = {};
+            return true;
+        }
+
+        void *const view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+        if (view == MAP_FAILED) {
+            return false;
+        }
+
+        *o_mapped_file = {
+            .contents = {static_cast<const t_u8 *>(view), static_cast<t_i32>(info.st_size)},
+        };
+
+        return true;
+#else
+        static_assert(false, "Platform not supported!");
+#endif
+    }
+
+    void FileUnmap(t_mapped_file *const mapped_file) {
+        if (mapped_file->contents.len > 0) {
+#if defined(ZCL_PLATFORM_WINDOWS)
+            UnmapViewOfFile(mapped_file->contents.raw);
+#elif defined(ZCL_PLATFORM_MACOS) || defined(ZCL_PLATFORM_LINUX)
+            munmap(const_cast<t_u8 *>(mapped_file->contents.raw), static_cast<size_t>(mapped_file->contents.len));
+#else
+            static_assert(false, "Platform not supported!");
+#endif
+        }
+
+        *mapped_file = {};
+    }
 }
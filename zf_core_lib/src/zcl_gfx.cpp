@@ -1,5 +1,6 @@
 #include <zcl/zcl_gfx.h>
 
+#include <zcl/zcl_algos.h>
 #include <zcl/zcl_file_sys.h>
 #include <stb_image.h>
 #include <stb_truetype.h>
@@ -26,6 +27,20 @@ namespace zcl {
         return true;
     }
 
+    void FontBuildGlyphTable(t_font_arrangement *const arrangement, t_arena *const arena) {
+        arrangement->glyph_table = ArenaPushArray<t_font_glyph_info>(arena, k_font_glyph_table_code_point_cnt);
+        ZeroClearItem(&arrangement->glyph_table_usage);
+
+        for (t_i32 i = 0; i < k_font_glyph_table_code_point_cnt; i++) {
+            t_font_glyph_info *glyph_info;
+
+            if (HashMapFind(&arrangement->code_pts_to_glyph_infos, static_cast<t_code_point>(i), &glyph_info)) {
+                arrangement->glyph_table[i] = *glyph_info;
+                BitsetSet(arrangement->glyph_table_usage, i);
+            }
+        }
+    }
+
     t_b8 FontLoadFromUnbuilt(const t_str_rdonly file_path, const t_i32 height, t_code_point_bitset *const code_pts, t_arena *const arrangement_arena, t_arena *const atlas_pixels_arr_arena, t_arena *const temp_arena, t_font_arrangement *const o_arrangement, t_array_mut<t_font_atlas_pixels_r8> *const o_atlas_pixels_arr) {
         ZCL_ASSERT(height > 0);
 
@@ -51,21 +66,18 @@ namespace zcl {
 
         // Filter out unsupported code points.
         {
-            const auto code_pts_indexes = zcl::BitsetLoadIndexesOfSet(*code_pts, temp_arena);
-
-            for (zcl::t_i32 i = 0; i < code_pts_indexes.len; i++) {
-                const zcl::t_i32 code_pt_index = code_pts_indexes[i];
+            ZCL_HIERARCHICAL_BITSET_WALK_SET(*code_pts, code_pt_index) {
                 const auto code_pt = static_cast<t_code_point>(code_pt_index);
 
                 const t_i32 glyph_index = stbtt_FindGlyphIndex(&stb_font_info, static_cast<t_i32>(code_pt));
 
                 if (glyph_index == 0) {
-                    BitsetUnset(*code_pts, code_pt_index);
+                    HierarchicalBitsetUnset(*code_pts, code_pt_index);
                 }
             }
         }
 
-        const auto code_pts_indexes_of_interest = zcl::BitsetLoadIndexesOfSet(*code_pts, temp_arena);
+        const auto code_pts_indexes_of_interest = zcl::HierarchicalBitsetLoadIndexesOfSet(*code_pts, temp_arena);
 
         if (code_pts_indexes_of_interest.len == 0) {
             return true;
@@ -78,6 +90,7 @@ namespace zcl {
         stbtt_GetFontVMetrics(&stb_font_info, &vm_ascent, &vm_descent, &vm_line_gap);
 
         o_arrangement->line_height = static_cast<t_i32>(static_cast<t_f32>(vm_ascent - vm_descent + vm_line_gap) * scale);
+        o_arrangement->ascent = static_cast<t_i32>(static_cast<t_f32>(vm_ascent) * scale);
 
         // ----------------------------------------
         // Glyph Info
@@ -99,7 +112,7 @@ namespace zcl {
             t_i32 bm_box_left, bm_box_top, bm_box_right, bm_box_bottom;
             stbtt_GetGlyphBitmapBox(&stb_font_info, glyph_index, scale, scale, &bm_box_left, &bm_box_top, &bm_box_right, &bm_box_bottom);
 
-            glyph_info.offs = {bm_box_left, bm_box_top + static_cast<t_i32>(static_cast<t_f32>(vm_ascent) * scale)};
+            glyph_info.offs = {bm_box_left, bm_box_top + o_arrangement->ascent};
             glyph_info.size = {bm_box_right - bm_box_left, bm_box_bottom - bm_box_top};
 
             ZCL_ASSERT(glyph_info.size.x <= k_font_atlas_texture_size.x && glyph_info.size.y <= k_font_atlas_texture_size.y);
@@ -128,6 +141,8 @@ namespace zcl {
 
         const t_i32 atlas_cnt = atlas_index + 1;
 
+        FontBuildGlyphTable(o_arrangement, arrangement_arena);
+
         // ------------------------------
 
         // ----------------------------------------
@@ -199,4 +214,110 @@ namespace zcl {
 
         return true;
     }
+
+    // Spaces and ASCII punctuation take the direction of the text around them.
+    static t_b8 CodePointCheckDirectionNeutral(const t_code_point code_pt) {
+        return code_pt < 0x80 && !(code_pt >= '0' && code_pt <= '9') && !(code_pt >= 'A' && code_pt <= 'Z') && !(code_pt >= 'a' && code_pt <= 'z');
+    }
+
+    t_font_shaped_line FontShapeSimple(const t_array_rdonly<t_code_point> line, const t_font_arrangement &arrangement, t_arena *const arena) {
+        if (line.len == 0) {
+            return {};
+        }
+
+        const auto glyphs = ArenaPushArray<t_font_shaped_glyph>(arena, line.len);
+
+        // Split into clusters, each being a base code point followed by any combining marks.
+        const auto cluster_begin_indexes = ArenaPushArray<t_i32>(arena, line.len + 1);
+        t_i32 cluster_cnt = 0;
+
+        for (t_i32 i = 0; i < line.len; i++) {
+            if (i == 0 || !CodePointCheckCombiningMark(line[i])) {
+                cluster_begin_indexes[cluster_cnt] = i;
+                cluster_cnt++;
+            }
+        }
+
+        cluster_begin_indexes[cluster_cnt] = line.len;
+
+        // Determine the visual order of clusters by reversing each run of right-to-left ones. Neutral clusters only join a run if more right-to-left text follows them.
+        const auto cluster_order = ArenaPushArray<t_i32>(arena, cluster_cnt);
+
+        for (t_i32 i = 0; i < cluster_cnt; i++) {
+            cluster_order[i] = i;
+        }
+
+        for (t_i32 i = 0; i < cluster_cnt;) {
+            if (!CodePointCheckRTL(line[cluster_begin_indexes[i]])) {
+                i++;
+                continue;
+            }
+
+            t_i32 run_end = i + 1;
+
+            for (t_i32 j = i + 1; j < cluster_cnt; j++) {
+                const t_code_point code_pt = line[cluster_begin_indexes[j]];
+
+                if (CodePointCheckRTL(code_pt)) {
+                    run_end = j + 1;
+                } else if (!CodePointCheckDirectionNeutral(code_pt)) {
+                    break;
+                }
+            }
+
+            Reverse(ArraySlice(cluster_order, i, run_end));
+            i = run_end;
+        }
+
+        // Position clusters in visual order.
+        t_i32 glyph_index = 0;
+        t_i32 pen_x = 0;
+
+        for (t_i32 i = 0; i < cluster_cnt; i++) {
+            const t_i32 cluster_begin_index = cluster_begin_indexes[cluster_order[i]];
+            const t_i32 cluster_end_index = cluster_begin_indexes[cluster_order[i] + 1];
+
+            const t_code_point base_code_pt = line[cluster_begin_index];
+
+            const t_font_glyph_info *base_glyph_info;
+
+            if (!FontFindGlyphInfo(arrangement, base_code_pt, &base_glyph_info)) {
+                ZCL_FATAL();
+            }
+
+            if (i > 0 && arrangement.has_kernings) {
+                const t_code_point base_code_pt_prev = line[cluster_begin_indexes[cluster_order[i - 1]]];
+
+                t_i32 *kerning;
+
+                if (HashMapFind(&arrangement.code_pt_pairs_to_kernings, {base_code_pt_prev, base_code_pt}, &kerning)) {
+                    pen_x += *kerning;
+                }
+            }
+
+            glyphs[glyph_index] = {.code_pt = base_code_pt, .src_index = cluster_begin_index, .pos = {pen_x, 0}};
+            glyph_index++;
+
+            for (t_i32 j = cluster_begin_index + 1; j < cluster_end_index; j++) {
+                const t_font_glyph_info *mark_glyph_info;
+
+                if (!FontFindGlyphInfo(arrangement, line[j], &mark_glyph_info)) {
+                    ZCL_FATAL();
+                }
+
+                // Zero-advance marks are designed to be drawn from where the base ends, otherwise centre them over the base.
+                const t_i32 mark_x = mark_glyph_info->adv == 0 ? pen_x + base_glyph_info->adv : pen_x + ((base_glyph_info->adv - mark_glyph_info->adv) / 2);
+
+                glyphs[glyph_index] = {.code_pt = line[j], .src_index = j, .pos = {mark_x, 0}};
+                glyph_index++;
+            }
+
+            pen_x += base_glyph_info->adv;
+        }
+
+        return {
+            .glyphs = glyphs,
+            .width = pen_x,
+        };
+    }
 }
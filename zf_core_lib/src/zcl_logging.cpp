@@ -0,0 +1,499 @@
+#include <zcl/zcl_logging.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <zcl/zcl_rings.h>
+
+namespace zcl {
+    struct t_log_record {
+        t_i64 timestamp; // Nanoseconds since the Unix epoch.
+        t_log_level level;
+        t_log_category category;
+        t_i32 thread_index;
+
+        const char *src_file_name;
+        t_i32 src_line;
+
+        t_static_array<t_u8, k_log_msg_len_limit> msg_bytes;
+        t_i32 msg_len;
+        t_b8 msg_truncated;
+    };
+
+    // Threads beyond this many get to share a ring.
+    constexpr t_i32 k_logger_thread_ring_limit = 32;
+
+    // How often the background thread wakes up to check for records when nobody has asked it to flush.
+    constexpr std::chrono::milliseconds k_logger_poll_interval(10);
+
+    constexpr t_i32 k_logger_file_write_buf_size = 1 << 16;
+
+    struct t_logger {
+        t_u64 id; // Unique across all loggers ever created, so that a thread can tell whether its cached ring belongs to this logger.
+
+        std::atomic<t_i32> level_min;
+        std::atomic<t_u64> category_enabled_mask;
+
+        // A thread claims a ring the first time it logs. Ring pointers and owners are written before the count is incremented, so any ring within the count can be read.
+        std::mutex ring_claim_mutex;
+        t_arena *ring_arena; // Protected by the claim mutex.
+        t_spsc_ring<t_log_record> *thread_rings[k_logger_thread_ring_limit];
+        t_i32 thread_ring_owners[k_logger_thread_ring_limit]; // The index of the thread which claimed each ring.
+        std::atomic<t_i32> thread_ring_cnt;
+        t_i32 thread_ring_cap;
+
+        t_mpmc_ring<t_log_record> *shared_ring;
+
+        std::atomic<t_i32> dropped_record_cnt;
+
+        std::thread thread;
+
+        std::mutex mutex;
+        std::condition_variable wake_cond; // Signalled to the background thread when a flush is requested or the logger is shutting down.
+        std::condition_variable flush_cond; // Signalled to flushing threads when the background thread finishes a pass.
+
+        // These are protected by the mutex.
+        t_i64 flush_ticket_requested;
+        t_i64 flush_ticket_completed;
+        t_b8 shutting_down;
+
+        // Everything below is only touched by the background thread once started.
+        t_b8 console;
+
+        t_str_mut file_path;
+        t_i32 file_size_limit;
+        t_i32 file_rotation_cnt;
+        t_file_stream file_stream;
+        t_array_mut<t_u8> file_write_buf;
+        t_i64 file_size;
+
+        t_array_mut<t_str_mut> category_names;
+
+        t_arena *temp_arena;
+        t_mem_stream line_stream;
+    };
+
+    static std::atomic<t_u64> g_logger_id_next = 1;
+    static std::atomic<t_i32> g_log_thread_index_next = 0;
+
+    // The ring the current thread last logged through, and which logger it belongs to. This only saves the lookup when a thread keeps logging to the same logger, since ownership itself is recorded in the logger.
+    static thread_local t_u64 g_log_thread_ring_logger_id = 0;
+    static thread_local t_i32 g_log_thread_ring_index = -1; // -1 if the shared ring.
+
+    static thread_local t_i32 g_log_thread_index = -1;
+
+    static t_i32 LogGetThreadIndex() {
+        if (g_log_thread_index == -1) {
+            g_log_thread_index = g_log_thread_index_next.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        return g_log_thread_index;
+    }
+
+    // Gives the index of the ring for the calling thread to use, claiming one if it hasn't yet.
+    static t_i32 LoggerGetThreadRingIndex(t_logger *const logger) {
+        if (g_log_thread_ring_logger_id == logger->id) {
+            return g_log_thread_ring_index;
+        }
+
+        const t_i32 thread_index = LogGetThreadIndex();
+
+        // Only the thread itself ever claims a ring for its index, so if it isn't within the count now it won't appear there while searching.
+        const t_i32 ring_cnt = logger->thread_ring_cnt.load(std::memory_order_acquire);
+
+        t_i32 ring_index = -1;
+
+        for (t_i32 i = 0; i < ring_cnt; i++) {
+            if (logger->thread_ring_owners[i] == thread_index) {
+                ring_index = i;
+                break;
+            }
+        }
+
+        if (ring_index == -1 && ring_cnt < k_logger_thread_ring_limit) {
+            const std::lock_guard lock(logger->ring_claim_mutex);
+
+            const t_i32 ring_cnt_locked = logger->thread_ring_cnt.load(std::memory_order_relaxed);
+
+            if (ring_cnt_locked < k_logger_thread_ring_limit) {
+                logger->thread_rings[ring_cnt_locked] = SPSCRingCreate<t_log_record>(logger->thread_ring_cap, logger->ring_arena);
+                logger->thread_ring_owners[ring_cnt_locked] = thread_index;
+                logger->thread_ring_cnt.store(ring_cnt_locked + 1, std::memory_order_release);
+
+                ring_index = ring_cnt_locked;
+            }
+        }
+
+        g_log_thread_ring_logger_id = logger->id;
+        g_log_thread_ring_index = ring_index;
+
+        return ring_index;
+    }
+
+    static t_str_rdonly LogLevelGetName(const t_log_level level) {
+        switch (level) {
+            case ek_log_level_debug: {
+                return ZCL_STR_LITERAL("DEBUG");
+            }
+
+            case ek_log_level_info: {
+                return ZCL_STR_LITERAL("INFO");
+            }
+
+            case ek_log_level_warning: {
+                return ZCL_STR_LITERAL("WARNING");
+            }
+
+            case ek_log_level_error: {
+                return ZCL_STR_LITERAL("ERROR");
+            }
+
+            case ekm_log_level_cnt: {
+                break;
+            }
+        }
+
+        ZCL_UNREACHABLE();
+    }
+
+    // Gives just the file name, without the directories.
+    static t_str_rdonly LogGetSrcFileName(const char *const src_file_path) {
+        const t_str_rdonly path = CStrToStr(src_file_path);
+
+        for (t_i32 i = path.bytes.len - 1; i >= 0; i--) {
+            if (path.bytes[i] == '/' || path.bytes[i] == '\\') {
+                return {ArraySliceFrom(path.bytes, i + 1)};
+            }
+        }
+
+        return path;
+    }
+
+    static void PrintZeroPadded(const t_stream_view stream_view, const t_i32 value, const t_i32 digit_cnt) {
+        for (t_i32 i = CalcDigitCount(value); i < digit_cnt; i++) {
+            Print(stream_view, ZCL_STR_LITERAL("0"));
+        }
+
+        PrintFormat(stream_view, "%", value);
+    }
+
+    // Puts the record together as a line of text, e.g. "2026-01-31 23:59:59.999 [INFO] [T0] [Audio] Message (file.cpp:123)".
+    static void LoggerPrintRecordLine(t_logger *const logger, const t_log_record &record, const t_stream_view stream_view) {
+        using namespace std::chrono;
+
+        const sys_time<milliseconds> time = floor<milliseconds>(sys_time<nanoseconds>(nanoseconds(record.timestamp)));
+        const sys_days date_days = floor<days>(time);
+        const year_month_day date = date_days;
+        const hh_mm_ss<milliseconds> time_of_day(time - date_days);
+
+        PrintZeroPadded(stream_view, static_cast<t_i32>(date.year()), 4);
+        Print(stream_view, ZCL_STR_LITERAL("-"));
+        PrintZeroPadded(stream_view, static_cast<t_i32>(static_cast<unsigned>(date.month())), 2);
+        Print(stream_view, ZCL_STR_LITERAL("-"));
+        PrintZeroPadded(stream_view, static_cast<t_i32>(static_cast<unsigned>(date.day())), 2);
+        Print(stream_view, ZCL_STR_LITERAL(" "));
+        PrintZeroPadded(stream_view, static_cast<t_i32>(time_of_day.hours().count()), 2);
+        Print(stream_view, ZCL_STR_LITERAL(":"));
+        PrintZeroPadded(stream_view, static_cast<t_i32>(time_of_day.minutes().count()), 2);
+        Print(stream_view, ZCL_STR_LITERAL(":"));
+        PrintZeroPadded(stream_view, static_cast<t_i32>(time_of_day.seconds().count()), 2);
+        Print(stream_view, ZCL_STR_LITERAL("."));
+        PrintZeroPadded(stream_view, static_cast<t_i32>(time_of_day.subseconds().count()), 3);
+
+        PrintFormat(stream_view, " [%] [T%] ", LogLevelGetName(record.level), record.thread_index);
+
+        if (record.category < logger->category_names.len) {
+            PrintFormat(stream_view, "[%] ", logger->category_names[record.category]);
+        } else {
+            PrintFormat(stream_view, "[%] ", record.category);
+        }
+
+        Print(stream_view, {ArraySlice(ArrayToNonstatic(&record.msg_bytes), 0, record.msg_len)});
+
+        if (record.msg_truncated) {
+            Print(stream_view, ZCL_STR_LITERAL("..."));
+        }
+
+        PrintFormat(stream_view, " (%:%)\n", LogGetSrcFileName(record.src_file_name), record.src_line);
+    }
+
+    static t_str_mut LoggerGetRotatedFilePath(const t_logger *const logger, const t_i32 index, t_arena *const arena) {
+        t_str_builder builder = StrBuilderCreate(arena);
+        StrBuilderAppendFormat(&builder, "%.%", logger->file_path, index);
+
+        return StrBuilderGetStrTerminated(&builder);
+    }
+
+    // Shifts each rotated-out file along by one (dropping the oldest), moves the current file into the first spot, then starts a fresh one.
+    static void LoggerRotateFile(t_logger *const logger) {
+        FileClose(&logger->file_stream);
+
+        if (logger->file_rotation_cnt > 0) {
+            const t_str_mut path_oldest = LoggerGetRotatedFilePath(logger, logger->file_rotation_cnt, logger->temp_arena);
+            remove(StrToCStr(path_oldest));
+
+            for (t_i32 i = logger->file_rotation_cnt - 1; i >= 1; i--) {
+                const t_str_mut path_src = LoggerGetRotatedFilePath(logger, i, logger->temp_arena);
+                const t_str_mut path_dest = LoggerGetRotatedFilePath(logger, i + 1, logger->temp_arena);
+                rename(StrToCStr(path_src), StrToCStr(path_dest));
+            }
+
+            const t_str_mut path_first = LoggerGetRotatedFilePath(logger, 1, logger->temp_arena);
+            rename(StrToCStr(StrCloneButAddTerminator(logger->file_path, logger->temp_arena)), StrToCStr(path_first));
+        }
+
+        logger->file_size = 0;
+
+        if (!FileOpen(logger->file_path, ek_file_access_mode_write, logger->temp_arena, &logger->file_stream)) {
+            // Nothing much that can be done here, so just carry on without a file.
+            logger->file_stream = {};
+            return;
+        }
+
+        FileStreamSetWriteBuffer(&logger->file_stream, logger->file_write_buf);
+    }
+
+    static void LoggerWriteRecord(t_logger *const logger, const t_log_record &record) {
+        MemStreamClear(&logger->line_stream);
+        LoggerPrintRecordLine(logger, record, MemStreamGetView(&logger->line_stream));
+
+        const t_array_rdonly<t_u8> line = MemStreamGetWritten(&logger->line_stream);
+
+        if (logger->console) {
+            t_file_stream console_stream = record.level >= ek_log_level_warning ? FileStreamCreateStdError() : FileStreamCreateStdOut();
+            static_cast<void>(StreamWriteItemsOfArray(FileStreamGetView(&console_stream), line));
+        }
+
+        if (logger->file_stream.open) {
+            if (logger->file_size_limit > 0 && logger->file_size > 0 && logger->file_size + line.len > logger->file_size_limit) {
+                LoggerRotateFile(logger);
+            }
+
+            if (logger->file_stream.open) {
+                static_cast<void>(StreamWriteItemsOfArray(FileStreamGetView(&logger->file_stream), line));
+                logger->file_size += line.len;
+            }
+        }
+
+        ArenaRewind(logger->temp_arena);
+    }
+
+    // Writes out every record currently in the rings. Returns the number written.
+    static t_i32 LoggerDrain(t_logger *const logger) {
+        t_i32 record_cnt = 0;
+        t_log_record record;
+
+        const t_i32 ring_cnt = logger->thread_ring_cnt.load(std::memory_order_acquire);
+
+        for (t_i32 i = 0; i < ring_cnt; i++) {
+            while (SPSCRingPop(logger->thread_rings[i], &record)) {
+                LoggerWriteRecord(logger, record);
+                record_cnt++;
+            }
+        }
+
+        while (MPMCRingPop(logger->shared_ring, &record)) {
+            LoggerWriteRecord(logger, record);
+            record_cnt++;
+        }
+
+        const t_i32 dropped_record_cnt = logger->dropped_record_cnt.exchange(0, std::memory_order_relaxed);
+
+        if (dropped_record_cnt > 0) {
+            t_log_record dropped_record = {
+                .timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count(),
+                .level = ek_log_level_warning,
+                .category = k_log_category_default,
+                .thread_index = LogGetThreadIndex(),
+                .src_file_name = __FILE__,
+                .src_line = __LINE__,
+            };
+
+            t_byte_stream msg_stream = ByteStreamCreate(ArrayToNonstatic(&dropped_record.msg_bytes), ek_stream_mode_write);
+            PrintFormat(ByteStreamGetView(&msg_stream), "% log records were dropped due to full rings!", dropped_record_cnt);
+            dropped_record.msg_len = msg_stream.byte_pos;
+
+            LoggerWriteRecord(logger, dropped_record);
+            record_cnt++;
+        }
+
+        return record_cnt;
+    }
+
+    static void LoggerThreadLoop(t_logger *const logger) {
+        while (true) {
+            t_i64 flush_ticket;
+            t_b8 shutting_down;
+
+            {
+                std::unique_lock lock(logger->mutex);
+
+                logger->wake_cond.wait_for(lock, k_logger_poll_interval, [logger]() {
+                    return logger->shutting_down || logger->flush_ticket_requested != logger->flush_ticket_completed;
+                });
+
+                flush_ticket = logger->flush_ticket_requested;
+                shutting_down = logger->shutting_down;
+            }
+
+            const t_i32 record_cnt = LoggerDrain(logger);
+
+            if (record_cnt > 0 || flush_ticket != logger->flush_ticket_completed) {
+                if (logger->console) {
+                    fflush(stdout);
+                    fflush(stderr);
+                }
+
+                if (logger->file_stream.open) {
+                    FileFlush(&logger->file_stream);
+                }
+            }
+
+            {
+                const std::lock_guard lock(logger->mutex);
+                logger->flush_ticket_completed = flush_ticket;
+            }
+
+            logger->flush_cond.notify_all();
+
+            if (shutting_down) {
+                return;
+            }
+        }
+    }
+
+    t_b8 LoggerCreate(const t_logger_config &config, t_arena *const arena, t_logger **const o_logger) {
+        ZCL_ASSERT(config.file_size_limit >= 0 && config.file_rotation_cnt >= 0);
+        ZCL_ASSERT(config.category_names.len <= k_log_category_limit);
+        ZCL_ASSERT(config.level_min >= 0 && config.level_min < ekm_log_level_cnt);
+
+        const auto logger = new (ArenaPushRaw(arena, ZCL_SIZE_OF(t_logger), ZCL_ALIGN_OF(t_logger))) t_logger();
+        logger->id = g_logger_id_next.fetch_add(1, std::memory_order_relaxed);
+
+        logger->level_min.store(config.level_min, std::memory_order_relaxed);
+        logger->category_enabled_mask.store(~static_cast<t_u64>(0), std::memory_order_relaxed);
+
+        logger->ring_arena = arena;
+        logger->thread_ring_cap = config.thread_ring_cap;
+        logger->shared_ring = MPMCRingCreate<t_log_record>(config.thread_ring_cap, arena);
+
+        logger->console = config.console;
+
+        logger->category_names = ArenaPushArray<t_str_mut>(arena, config.category_names.len);
+
+        for (t_i32 i = 0; i < config.category_names.len; i++) {
+            logger->category_names[i] = StrClone(config.category_names[i], arena);
+        }
+
+        logger->temp_arena = ArenaCreateBlockBased();
+        logger->line_stream = MemStreamCreate(arena, 256);
+
+        if (!StrCheckEmpty(config.file_path)) {
+            logger->file_path = StrClone(config.file_path, arena);
+            logger->file_size_limit = config.file_size_limit;
+            logger->file_rotation_cnt = config.file_rotation_cnt;
+
+            if (!FileOpenRecursive(config.file_path, ek_file_access_mode_write, logger->temp_arena, &logger->file_stream)) {
+                ArenaDestroy(logger->temp_arena);
+                logger->~t_logger();
+                return false;
+            }
+
+            logger->file_write_buf = ArenaPushArray<t_u8>(arena, k_logger_file_write_buf_size);
+            FileStreamSetWriteBuffer(&logger->file_stream, logger->file_write_buf);
+
+            ArenaRewind(logger->temp_arena);
+        }
+
+        logger->thread = std::thread(LoggerThreadLoop, logger);
+
+        *o_logger = logger;
+
+        return true;
+    }
+
+    void LoggerDestroy(t_logger *const logger) {
+        {
+            const std::lock_guard lock(logger->mutex);
+            logger->shutting_down = true;
+        }
+
+        logger->wake_cond.notify_one();
+        logger->thread.join();
+
+        if (logger->file_stream.open) {
+            FileClose(&logger->file_stream);
+        }
+
+        ArenaDestroy(logger->temp_arena);
+
+        logger->~t_logger();
+    }
+
+    void LoggerFlush(t_logger *const logger) {
+        std::unique_lock lock(logger->mutex);
+
+        logger->flush_ticket_requested++;
+        const t_i64 flush_ticket = logger->flush_ticket_requested;
+
+        logger->wake_cond.notify_one();
+
+        logger->flush_cond.wait(lock, [logger, flush_ticket]() {
+            return logger->flush_ticket_completed >= flush_ticket;
+        });
+    }
+
+    void LoggerSetLevelMin(t_logger *const logger, const t_log_level level) {
+        ZCL_ASSERT(level >= 0 && level < ekm_log_level_cnt);
+        logger->level_min.store(level, std::memory_order_relaxed);
+    }
+
+    void LoggerSetCategoryEnabled(t_logger *const logger, const t_log_category category, const t_b8 enabled) {
+        ZCL_ASSERT(category >= 0 && category < k_log_category_limit);
+
+        const t_u64 category_mask = static_cast<t_u64>(1) << category;
+
+        if (enabled) {
+            logger->category_enabled_mask.fetch_or(category_mask, std::memory_order_relaxed);
+        } else {
+            logger->category_enabled_mask.fetch_and(~category_mask, std::memory_order_relaxed);
+        }
+    }
+
+    t_b8 LoggerCheckEnabled(const t_logger *const logger, const t_log_level level, const t_log_category category) {
+        ZCL_ASSERT(category >= 0 && category < k_log_category_limit);
+
+        if (level < logger->level_min.load(std::memory_order_relaxed)) {
+            return false;
+        }
+
+        return (logger->category_enabled_mask.load(std::memory_order_relaxed) & (static_cast<t_u64>(1) << category)) != 0;
+    }
+
+    void internal::LoggerSubmit(t_logger *const logger, const t_log_level level, const t_log_category category, const std::source_location &src_loc, const t_array_rdonly<t_u8> msg, const t_b8 msg_truncated) {
+        ZCL_ASSERT(msg.len <= k_log_msg_len_limit);
+
+        t_log_record record = {
+            .timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count(),
+            .level = level,
+            .category = category,
+            .thread_index = LogGetThreadIndex(),
+            .src_file_name = src_loc.file_name(),
+            .src_line = static_cast<t_i32>(src_loc.line()),
+            .msg_len = msg.len,
+            .msg_truncated = msg_truncated,
+        };
+
+        ArrayCopy(msg, ArrayToNonstatic(&record.msg_bytes));
+
+        const t_i32 ring_index = LoggerGetThreadRingIndex(logger);
+
+        const t_b8 pushed = ring_index == -1 ? MPMCRingPush(logger->shared_ring, record) : SPSCRingPush(logger->thread_rings[ring_index], record);
+
+        if (!pushed) {
+            logger->dropped_record_cnt.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
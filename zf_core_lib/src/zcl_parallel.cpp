@@ -0,0 +1,165 @@
+#include <zcl/zcl_parallel.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+
+namespace zcl {
+    struct t_worker_pool {
+        std::thread *workers;
+        t_i32 worker_cnt;
+
+        std::mutex mutex;
+        std::condition_variable batch_begin_cond; // Signalled to workers when a batch is submitted or the pool is shutting down.
+        std::condition_variable batch_end_cond; // Signalled to the submitting thread when the last busy worker finishes.
+
+        // These are protected by the mutex.
+        t_i32 batch_id; // Incremented per batch so workers can tell a new batch from a spurious wakeup.
+        t_i32 busy_worker_cnt;
+        t_b8 shutting_down;
+        t_b8 running;
+
+        // These describe the current batch, and are only written while no worker is busy.
+        t_worker_pool_task_func task_func;
+        void *task_user_data;
+        t_i32 task_cnt;
+
+        std::atomic<t_i32> task_index_next;
+    };
+
+    // Keeps claiming and running tasks of the current batch until there are none left.
+    static void WorkerPoolRunTasks(t_worker_pool *const pool) {
+        while (true) {
+            const t_i32 task_index = pool->task_index_next.fetch_add(1, std::memory_order_relaxed);
+
+            if (task_index >= pool->task_cnt) {
+                break;
+            }
+
+            pool->task_func(task_index, pool->task_user_data);
+        }
+    }
+
+    static void WorkerPoolWorkerLoop(t_worker_pool *const pool) {
+        t_i32 batch_id_last = 0;
+
+        while (true) {
+            {
+                std::unique_lock lock(pool->mutex);
+
+                pool->batch_begin_cond.wait(lock, [pool, batch_id_last]() {
+                    return pool->shutting_down || pool->batch_id != batch_id_last;
+                });
+
+                if (pool->shutting_down) {
+                    return;
+                }
+
+                batch_id_last = pool->batch_id;
+            }
+
+            WorkerPoolRunTasks(pool);
+
+            {
+                const std::lock_guard lock(pool->mutex);
+
+                pool->busy_worker_cnt--;
+
+                if (pool->busy_worker_cnt == 0) {
+                    pool->batch_end_cond.notify_one();
+                }
+            }
+        }
+    }
+
+    t_i32 WorkerPoolGetDefaultWorkerCount() {
+        const auto hardware_thread_cnt = static_cast<t_i32>(std::thread::hardware_concurrency());
+        return CalcMax(hardware_thread_cnt - 1, 0); // This can be 0 if the count couldn't be determined.
+    }
+
+    t_worker_pool *WorkerPoolCreate(const t_i32 worker_cnt, t_arena *const arena) {
+        ZCL_ASSERT(worker_cnt >= 0);
+
+        const auto pool = new (ArenaPushRaw(arena, ZCL_SIZE_OF(t_worker_pool), ZCL_ALIGN_OF(t_worker_pool))) t_worker_pool();
+        pool->worker_cnt = worker_cnt;
+
+        if (worker_cnt > 0) {
+            pool->workers = static_cast<std::thread *>(ArenaPushRaw(arena, ZCL_SIZE_OF(std::thread) * worker_cnt, ZCL_ALIGN_OF(std::thread)));
+
+            for (t_i32 i = 0; i < worker_cnt; i++) {
+                new (&pool->workers[i]) std::thread(WorkerPoolWorkerLoop, pool);
+            }
+        }
+
+        return pool;
+    }
+
+    void WorkerPoolDestroy(t_worker_pool *const pool) {
+        ZCL_ASSERT(!pool->running);
+
+        {
+            const std::lock_guard lock(pool->mutex);
+            pool->shutting_down = true;
+        }
+
+        pool->batch_begin_cond.notify_all();
+
+        for (t_i32 i = 0; i < pool->worker_cnt; i++) {
+            pool->workers[i].join();
+            pool->workers[i].~thread();
+        }
+
+        pool->~t_worker_pool();
+    }
+
+    t_i32 WorkerPoolGetWorkerCount(const t_worker_pool *const pool) {
+        return pool->worker_cnt;
+    }
+
+    void WorkerPoolRunRaw(t_worker_pool *const pool, const t_i32 task_cnt, const t_worker_pool_task_func func, void *const user_data) {
+        ZCL_ASSERT(task_cnt >= 0);
+        ZCL_ASSERT(!pool->running && "Tasks cannot submit batches to the pool they're running on!");
+
+        if (task_cnt == 0) {
+            return;
+        }
+
+        // Not worth waking anyone up.
+        if (pool->worker_cnt == 0 || task_cnt == 1) {
+            for (t_i32 i = 0; i < task_cnt; i++) {
+                func(i, user_data);
+            }
+
+            return;
+        }
+
+        {
+            const std::lock_guard lock(pool->mutex);
+
+            pool->running = true;
+
+            pool->task_func = func;
+            pool->task_user_data = user_data;
+            pool->task_cnt = task_cnt;
+            pool->task_index_next.store(0, std::memory_order_relaxed);
+
+            pool->busy_worker_cnt = pool->worker_cnt;
+            pool->batch_id++;
+        }
+
+        pool->batch_begin_cond.notify_all();
+
+        WorkerPoolRunTasks(pool);
+
+        {
+            std::unique_lock lock(pool->mutex);
+
+            pool->batch_end_cond.wait(lock, [pool]() {
+                return pool->busy_worker_cnt == 0;
+            });
+
+            pool->running = false;
+        }
+    }
+}
@@ -126,25 +126,4 @@ namespace zcl {
 
         return true;
     }
-
-    t_i32 PrintFormatCountSpecs(const t_str_rdonly str) {
-        static_assert(CodePointCheckASCII(k_print_format_spec) && CodePointCheckASCII(k_print_format_esc)); // Assuming this for this algorithm.
-
-        t_b8 escaped = false;
-        t_i32 cnt = 0;
-
-        for (t_i32 i = 0; i < str.bytes.len; i++) {
-            if (!escaped) {
-                if (str.bytes[i] == k_print_format_esc) {
-                    escaped = true;
-                } else if (str.bytes[i] == k_print_format_spec) {
-                    cnt++;
-                }
-            } else {
-                escaped = false;
-            }
-        }
-
-        return cnt;
-    }
 }
@@ -118,6 +118,10 @@ namespace zcl {
             return false;
         }
 
+        if (!StreamWriteItem(stream_view, arrangement.ascent)) {
+            return false;
+        }
+
         if (!SerializeHashMap(stream_view, &arrangement.code_pts_to_glyph_infos, temp_arena)) {
             return false;
         }
@@ -140,6 +144,10 @@ namespace zcl {
             return false;
         }
 
+        if (!StreamReadItem(stream_view, &o_arrangement->ascent)) {
+            return false;
+        }
+
         if (!DeserializeHashMap(stream_view, arrangement_arena, k_font_code_point_hash_func, temp_arena, &o_arrangement->code_pts_to_glyph_infos, k_comparator_bin_default<t_code_point>)) {
             return false;
         }
@@ -148,6 +156,8 @@ namespace zcl {
             return false;
         }
 
+        FontBuildGlyphTable(o_arrangement, arrangement_arena);
+
         if (!DeserializeArray(stream_view, atlas_pixels_arr_arena, o_atlas_pixels_arr)) {
             return false;
         }
@@ -1,5 +1,16 @@
 #include <zcl/zcl_strs.h>
 
+#include <bit>
+#include <zcl/zcl_lists.h>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define ZCL_UTF8_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define ZCL_UTF8_SIMD_SSE2
+#endif
+
 namespace zcl {
     enum t_utf8_byte_type : t_i32 {
         ek_utf8_byte_type_ascii,
@@ -384,72 +395,177 @@ namespace zcl {
         return result;
     }
 
-    t_b8 StrCheckValidUTF8(const t_str_rdonly str) {
-        t_i32 cost = 0;
+    // UTF-8 is processed in blocks, with a bitmask for each byte class where bit N corresponds to byte N of the block. This lets a whole block be checked with a few integer operations, and lets blocks of ASCII be skipped right away.
+#if defined(ZCL_UTF8_SIMD_AVX2)
+    constexpr t_i32 k_utf8_block_len = 32;
+#elif defined(ZCL_UTF8_SIMD_SSE2)
+    constexpr t_i32 k_utf8_block_len = 16;
+#else
+    constexpr t_i32 k_utf8_block_len = 8;
+#endif
+
+    constexpr t_u64 k_utf8_block_mask = (static_cast<t_u64>(1) << k_utf8_block_len) - 1;
+
+    struct t_utf8_block_masks {
+        t_u64 non_ascii;
+        t_u64 continuation;
+        t_u64 lead_2_plus; // Start bytes of sequences 2 bytes or longer.
+        t_u64 lead_3_plus;
+        t_u64 lead_4;
+        t_u64 invalid;
+    };
 
-        for (t_i32 i = 0; i < str.bytes.len; i++) {
-            const auto byte_type = k_utf8_byte_type_table[str.bytes[i]];
+    static t_utf8_block_masks UTF8LoadBlockMasks(const t_u8 *const bytes) {
+#if defined(ZCL_UTF8_SIMD_AVX2)
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes));
+        const __m256i v_biased = _mm256_xor_si256(v, _mm256_set1_epi8(static_cast<char>(0x80))); // Makes signed comparisons order the bytes as if they were unsigned.
+
+        const auto to_mask = [](const __m256i cmp) { return static_cast<t_u64>(static_cast<t_u32>(_mm256_movemask_epi8(cmp))); };
+
+        return {
+            .non_ascii = to_mask(v),
+            .continuation = to_mask(_mm256_cmpgt_epi8(_mm256_set1_epi8(-64), v)),
+            .lead_2_plus = to_mask(_mm256_cmpgt_epi8(v_biased, _mm256_set1_epi8(0x3F))),
+            .lead_3_plus = to_mask(_mm256_cmpgt_epi8(v_biased, _mm256_set1_epi8(0x5F))),
+            .lead_4 = to_mask(_mm256_cmpgt_epi8(v_biased, _mm256_set1_epi8(0x6F))),
+            .invalid = to_mask(_mm256_cmpgt_epi8(v_biased, _mm256_set1_epi8(0x77))),
+        };
+#elif defined(ZCL_UTF8_SIMD_SSE2)
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes));
+        const __m128i v_biased = _mm_xor_si128(v, _mm_set1_epi8(static_cast<char>(0x80))); // Makes signed comparisons order the bytes as if they were unsigned.
+
+        const auto to_mask = [](const __m128i cmp) { return static_cast<t_u64>(_mm_movemask_epi8(cmp)); };
+
+        return {
+            .non_ascii = to_mask(v),
+            .continuation = to_mask(_mm_cmplt_epi8(v, _mm_set1_epi8(-64))),
+            .lead_2_plus = to_mask(_mm_cmpgt_epi8(v_biased, _mm_set1_epi8(0x3F))),
+            .lead_3_plus = to_mask(_mm_cmpgt_epi8(v_biased, _mm_set1_epi8(0x5F))),
+            .lead_4 = to_mask(_mm_cmpgt_epi8(v_biased, _mm_set1_epi8(0x6F))),
+            .invalid = to_mask(_mm_cmpgt_epi8(v_biased, _mm_set1_epi8(0x77))),
+        };
+#else
+        t_utf8_block_masks result = {};
+
+        for (t_i32 i = 0; i < k_utf8_block_len; i++) {
+            const t_u64 bit = static_cast<t_u64>(1) << i;
+
+            const auto byte_type = k_utf8_byte_type_table[bytes[i]];
+
+            if (byte_type != ek_utf8_byte_type_ascii) {
+                result.non_ascii |= bit;
+            }
 
-            switch (byte_type) {
-                case ek_utf8_byte_type_ascii:
-                case ek_utf8_byte_type_2byte_start:
-                case ek_utf8_byte_type_3byte_start:
-                case ek_utf8_byte_type_4byte_start: {
-                    if (cost > 0) {
-                        return false;
-                    }
+            if (byte_type >= ek_utf8_byte_type_2byte_start && byte_type <= ek_utf8_byte_type_4byte_start) {
+                result.lead_2_plus |= bit;
+            }
 
-                    cost = byte_type - ek_utf8_byte_type_ascii + 1;
+            if (byte_type >= ek_utf8_byte_type_3byte_start && byte_type <= ek_utf8_byte_type_4byte_start) {
+                result.lead_3_plus |= bit;
+            }
 
-                    break;
-                }
+            if (byte_type == ek_utf8_byte_type_4byte_start) {
+                result.lead_4 |= bit;
+            }
 
-                case ek_utf8_byte_type_continuation: {
-                    if (cost == 0) {
-                        return false;
-                    }
+            if (byte_type == ek_utf8_byte_type_continuation) {
+                result.continuation |= bit;
+            }
 
-                    break;
-                }
+            if (byte_type == ek_utf8_byte_type_invalid) {
+                result.invalid |= bit;
+            }
+        }
 
-                case ek_utf8_byte_type_invalid: {
-                    return false;
-                }
+        return result;
+#endif
+    }
+
+    static t_u64 UTF8LoadBlockContinuationMask(const t_u8 *const bytes) {
+#if defined(ZCL_UTF8_SIMD_AVX2)
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes));
+        return static_cast<t_u32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_set1_epi8(-64), v)));
+#elif defined(ZCL_UTF8_SIMD_SSE2)
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes));
+        return static_cast<t_u64>(_mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8(-64))));
+#else
+        t_u64 result = 0;
+
+        for (t_i32 i = 0; i < k_utf8_block_len; i++) {
+            if ((bytes[i] & 0xC0) == 0x80) {
+                result |= static_cast<t_u64>(1) << i;
             }
+        }
 
-            cost--;
+        return result;
+#endif
+    }
+
+    // Checks a block given the continuation bytes still owed by sequences started in earlier blocks, and updates that for the next block.
+    // A block is valid iff its continuation bytes are exactly the ones owed by the start bytes before them.
+    static t_b8 UTF8CheckBlockValid(const t_u8 *const bytes, t_u64 *const owed) {
+        const t_utf8_block_masks masks = UTF8LoadBlockMasks(bytes);
+
+        if (masks.non_ascii == 0) {
+            return *owed == 0;
+        }
+
+        if (masks.invalid != 0) {
+            return false;
+        }
+
+        const t_u64 required = (masks.lead_2_plus << 1) | (masks.lead_3_plus << 2) | (masks.lead_4 << 3) | *owed;
+
+        if ((required & k_utf8_block_mask) != masks.continuation) {
+            return false;
         }
 
+        *owed = required >> k_utf8_block_len;
+
         return true;
     }
 
+    t_b8 StrCheckValidUTF8(const t_str_rdonly str) {
+        t_u64 owed = 0;
+        t_i32 i = 0;
+
+        for (; i + k_utf8_block_len <= str.bytes.len; i += k_utf8_block_len) {
+            if (!UTF8CheckBlockValid(str.bytes.raw + i, &owed)) {
+                return false;
+            }
+        }
+
+        if (i < str.bytes.len) {
+            // The padding is ASCII, so any sequence cut off by the end of the string will be missing its continuation bytes.
+            t_static_array<t_u8, k_utf8_block_len> tail = {};
+            ArrayCopy(ArraySliceFrom(str.bytes, i), ArrayToNonstatic(&tail));
+
+            if (!UTF8CheckBlockValid(tail.raw, &owed)) {
+                return false;
+            }
+        }
+
+        return owed == 0;
+    }
+
     t_i32 StrCalcLen(const t_str_rdonly str) {
         ZCL_ASSERT(StrCheckValidUTF8(str));
 
+        // Given the string is valid, every byte that isn't a continuation byte starts a code point.
+        t_i32 continuation_cnt = 0;
         t_i32 i = 0;
-        t_i32 len = 0;
-
-        while (i < str.bytes.len) {
-            const auto byte_type = k_utf8_byte_type_table[str.bytes[i]];
 
-            switch (byte_type) {
-                case ek_utf8_byte_type_ascii:
-                case ek_utf8_byte_type_2byte_start:
-                case ek_utf8_byte_type_3byte_start:
-                case ek_utf8_byte_type_4byte_start: {
-                    i += byte_type - ek_utf8_byte_type_ascii + 1;
-                    break;
-                }
+        for (; i + k_utf8_block_len <= str.bytes.len; i += k_utf8_block_len) {
+            continuation_cnt += std::popcount(UTF8LoadBlockContinuationMask(str.bytes.raw + i));
+        }
 
-                default: {
-                    ZCL_UNREACHABLE();
-                }
+        for (; i < str.bytes.len; i++) {
+            if (k_utf8_byte_type_table[str.bytes[i]] == ek_utf8_byte_type_continuation) {
+                continuation_cnt++;
             }
-
-            len++;
         }
 
-        return len;
+        return str.bytes.len - continuation_cnt;
     }
 
     t_code_point StrFindCodePointAtByte(const t_str_rdonly str, const t_i32 byte_index) {
@@ -523,7 +639,7 @@ namespace zcl {
         ZCL_ASSERT(StrCheckValidUTF8(str));
 
         ZCL_STR_WALK (str, step) {
-            BitsetSet(*code_pts, static_cast<t_i32>(step.code_pt));
+            HierarchicalBitsetSet(*code_pts, static_cast<t_i32>(step.code_pt));
         }
     }
 
@@ -598,4 +714,102 @@ namespace zcl {
             }
         }
     }
+
+    struct t_str_interner {
+        t_arena *arena;
+
+        t_list<t_str_rdonly> strs; // Indexed by ID.
+        t_list<t_i32> str_hashes; // Kept so that growing the table doesn't mean rehashing every string.
+
+        t_array_mut<t_i32> table; // Open addressing with linear probing. Each slot holds an ID, or -1 if empty. The length is always a power of 2, and at least double the string count.
+    };
+
+    static t_array_mut<t_i32> StrInternerCreateTable(const t_i32 len, t_arena *const arena) {
+        const auto table = ArenaPushArray<t_i32>(arena, len);
+        SetAllTo(table, -1);
+        return table;
+    }
+
+    // Gives the index of the table slot holding the ID of the string, or of the empty slot where it would go.
+    static t_i32 StrInternerFindSlot(const t_str_interner *const interner, const t_str_rdonly str, const t_i32 hash) {
+        const t_i32 mask = interner->table.len - 1;
+
+        for (t_i32 slot_index = hash & mask;; slot_index = (slot_index + 1) & mask) {
+            const t_i32 id_index = interner->table[slot_index];
+
+            if (id_index == -1 || (interner->str_hashes[id_index] == hash && StrsCheckEqual(interner->strs[id_index], str))) {
+                return slot_index;
+            }
+        }
+    }
+
+    t_str_interner *StrInternerCreate(t_arena *const arena, const t_i32 cap) {
+        ZCL_ASSERT(cap > 0);
+
+        const auto interner = ArenaPush<t_str_interner>(arena);
+        interner->arena = arena;
+        interner->strs = ListCreate<t_str_rdonly>(cap, arena);
+        interner->str_hashes = ListCreate<t_i32>(cap, arena);
+        interner->table = StrInternerCreateTable(static_cast<t_i32>(std::bit_ceil(static_cast<t_u32>(cap * 2))), arena);
+
+        return interner;
+    }
+
+    t_i32 StrInternerGetCount(const t_str_interner *const interner) {
+        return interner->strs.len;
+    }
+
+    t_str_id StrIntern(t_str_interner *const interner, const t_str_rdonly str) {
+        const t_i32 hash = k_str_hash_func(str);
+
+        t_i32 slot_index = StrInternerFindSlot(interner, str, hash);
+
+        if (interner->table[slot_index] != -1) {
+            return {interner->table[slot_index]};
+        }
+
+        const t_i32 id_index = interner->strs.len;
+
+        if ((id_index + 1) * 2 > interner->table.len) {
+            interner->table = StrInternerCreateTable(interner->table.len * 2, interner->arena);
+
+            const t_i32 mask = interner->table.len - 1;
+
+            for (t_i32 i = 0; i < interner->strs.len; i++) {
+                t_i32 rehomed_slot_index = interner->str_hashes[i] & mask;
+
+                while (interner->table[rehomed_slot_index] != -1) {
+                    rehomed_slot_index = (rehomed_slot_index + 1) & mask;
+                }
+
+                interner->table[rehomed_slot_index] = i;
+            }
+
+            slot_index = StrInternerFindSlot(interner, str, hash);
+        }
+
+        ListAppendDynamic(&interner->strs, StrCheckEmpty(str) ? t_str_rdonly{} : StrClone(str, interner->arena), interner->arena);
+        ListAppendDynamic(&interner->str_hashes, hash, interner->arena);
+
+        interner->table[slot_index] = id_index;
+
+        return {id_index};
+    }
+
+    t_b8 StrInternerFind(const t_str_interner *const interner, const t_str_rdonly str, t_str_id *const o_id) {
+        const t_i32 slot_index = StrInternerFindSlot(interner, str, k_str_hash_func(str));
+
+        if (interner->table[slot_index] == -1) {
+            return false;
+        }
+
+        *o_id = {interner->table[slot_index]};
+
+        return true;
+    }
+
+    t_str_rdonly StrInternerGetStr(const t_str_interner *const interner, const t_str_id id) {
+        ZCL_ASSERT(id.index >= 0 && id.index < interner->strs.len);
+        return interner->strs[id.index];
+    }
 }
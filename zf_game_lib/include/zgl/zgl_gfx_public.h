@@ -49,6 +49,9 @@ namespace zgl {
 
     t_gfx_resource *TextureCreateFromBuilt(const t_gfx_ticket_mut gfx_ticket, const zcl::t_str_rdonly file_path, t_gfx_resource_group *const group, zcl::t_arena *const temp_arena);
 
+    // Same as above, but for a built file already loaded into memory (e.g. through a file loader).
+    t_gfx_resource *TextureCreateFromBuiltContents(const t_gfx_ticket_mut gfx_ticket, const zcl::t_array_mut<zcl::t_u8> contents, t_gfx_resource_group *const group, zcl::t_arena *const temp_arena);
+
     t_gfx_resource *TextureCreateFromUnbuilt(const t_gfx_ticket_mut gfx_ticket, const zcl::t_str_rdonly file_path, t_gfx_resource_group *const group, zcl::t_arena *const temp_arena);
 
     t_gfx_resource *TextureCreateTarget(const t_gfx_ticket_mut gfx_ticket, const zcl::t_v2_i size, t_gfx_resource_group *const resource_group);
@@ -70,6 +73,9 @@ namespace zgl {
 
     t_gfx_resource *ShaderProgCreateFromBuilt(const t_gfx_ticket_mut gfx_ticket, const zcl::t_str_rdonly vertex_shader_file_path, const zcl::t_str_rdonly fragment_shader_file_path, t_gfx_resource_group *const group, zcl::t_arena *const temp_arena);
 
+    // Same as above, but for built files already loaded into memory.
+    t_gfx_resource *ShaderProgCreateFromBuiltContents(const t_gfx_ticket_mut gfx_ticket, const zcl::t_array_mut<zcl::t_u8> vertex_shader_contents, const zcl::t_array_mut<zcl::t_u8> fragment_shader_contents, t_gfx_resource_group *const group, zcl::t_arena *const temp_arena);
+
     enum t_uniform_type : zcl::t_i32 {
         ek_uniform_type_sampler,
         ek_uniform_type_v4,
@@ -93,11 +99,17 @@ namespace zgl {
 
     t_font FontCreateFromBuilt(const t_gfx_ticket_mut gfx_ticket, const zcl::t_str_rdonly file_path, t_gfx_resource_group *const resource_group, zcl::t_arena *const temp_arena);
 
+    // Same as above, but for a built file already loaded into memory.
+    t_font FontCreateFromBuiltContents(const t_gfx_ticket_mut gfx_ticket, const zcl::t_array_mut<zcl::t_u8> contents, t_gfx_resource_group *const resource_group, zcl::t_arena *const temp_arena);
+
     t_font FontCreateFromUnbuilt(const t_gfx_ticket_mut gfx_ticket, const zcl::t_str_rdonly file_path, const zcl::t_i32 height, zcl::t_code_point_bitset *const code_pts, t_gfx_resource_group *const resource_group, zcl::t_arena *const temp_arena);
 
     namespace internal {
         t_gfx_ticket_mut GFXStartup(const t_platform_ticket_rdonly platform_ticket);
 
+        // Starts up against the no-op renderer with no window, for benchmarks and tooling which need to drive the full rendering path without presenting anything.
+        t_gfx_ticket_mut GFXStartupHeadless(const zcl::t_v2_i backbuffer_size);
+
         void GFXShutdown(const t_gfx_ticket_mut gfx_ticket);
 
         t_gfx_resource *VertexBufCreate(const t_gfx_ticket_mut gfx_ticket, const zcl::t_i32 vertex_cnt, t_gfx_resource_group *const resource_group);
@@ -105,6 +105,10 @@ namespace zgl {
 
     t_str_render_info_mut CalcStrRenderInfo(const zcl::t_str_rdonly str, const zcl::t_font_arrangement &font_arrangement, const zcl::t_v2 origin, zcl::t_arena *const arena);
 
+    // Like CalcStrRenderInfo, but lines are passed through the given shaper so that combining marks and right-to-left text are positioned correctly. Strings with no code points needing shaping take the unshaped path.
+    // Offsets are still indexed by code point, so the result can be given to anything that takes a normal render info.
+    t_str_render_info_mut CalcStrRenderInfoShaped(const zcl::t_str_rdonly str, const zcl::t_font_arrangement &font_arrangement, const zcl::t_v2 origin, const zcl::t_font_shaper shaper, zcl::t_arena *const arena, zcl::t_arena *const temp_arena);
+
     zcl::t_poly_mut CalcStrRenderCollider(const zcl::t_str_rdonly str, const t_str_render_info_rdonly render_info, const t_font &font, const zcl::t_v2 pos, zcl::t_arena *const arena, const zcl::t_v2 origin = zcl::k_origin_top_left, const zcl::t_f32 rot = 0.0f, const zcl::t_v2 scale = {1.0f, 1.0f});
 
     inline zcl::t_poly_mut CalcStrRenderCollider(const zcl::t_str_rdonly str, const t_font &font, const zcl::t_v2 pos, zcl::t_arena *const arena, zcl::t_arena *const temp_arena, const zcl::t_v2 origin = zcl::k_origin_top_left, const zcl::t_f32 rot = 0.0f, const zcl::t_v2 scale = {1.0f, 1.0f}) {
@@ -126,6 +130,68 @@ namespace zgl {
         RendererSubmitStr(rc, str, render_info, font, pos, color, rot, scale);
     }
 
+    struct t_str_layout_run {
+        const t_gfx_resource *texture;
+        zcl::t_i32 triangle_cnt;
+    };
+
+    // A string prebuilt into glyph triangles, for text which does not change between frames. Triangle positions are relative to the position given on submission.
+    struct t_str_layout_rdonly {
+        zcl::t_array_rdonly<t_gfx_triangle> triangles;
+        zcl::t_array_rdonly<t_str_layout_run> runs; // Consecutive triangles sharing an atlas texture.
+        zcl::t_v2 size;
+    };
+
+    struct t_str_layout_mut {
+        zcl::t_array_mut<t_gfx_triangle> triangles;
+        zcl::t_array_mut<t_str_layout_run> runs;
+        zcl::t_v2 size;
+
+        operator t_str_layout_rdonly() const {
+            return {
+                .triangles = triangles,
+                .runs = runs,
+                .size = size,
+            };
+        }
+    };
+
+    // The layout references the atlas textures of the font, so the font must outlive it.
+    t_str_layout_mut StrLayoutCreate(const zcl::t_str_rdonly str, const t_font &font, const zcl::t_color_rgba32f color, zcl::t_arena *const arena, zcl::t_arena *const temp_arena, const zcl::t_v2 origin = zcl::k_origin_top_left, const zcl::t_f32 rot = 0.0f, const zcl::t_v2 scale = {1.0f, 1.0f});
+
+    // Copies the prebuilt triangles into the batch with no per-glyph layout work.
+    void RendererSubmitStrLayout(const t_rendering_context rc, const t_str_layout_rdonly layout, const zcl::t_v2 pos);
+
+    // ============================================================
+    // @section: Text Layout
+
+    enum t_text_align : zcl::t_i32 {
+        ek_text_align_left,
+        ek_text_align_center,
+        ek_text_align_right,
+        ek_text_align_justified // Lines ending in an explicit line break, and the last line, are left aligned.
+    };
+
+    struct t_text_span {
+        zcl::t_str_rdonly str;
+        const t_font *font;
+        zcl::t_color_rgba32f color;
+    };
+
+    struct t_text_metrics {
+        zcl::t_v2 size; // Width is the wrap width if wrapping, otherwise the width of the widest line.
+        zcl::t_f32 widest_line_width;
+        zcl::t_i32 line_cnt;
+    };
+
+    // Give a wrap width of 0 for no wrapping. Lines only break at spaces, unless a single word is wider than the wrap width.
+    t_text_metrics TextMeasure(const zcl::t_array_rdonly<t_text_span> spans, const zcl::t_f32 wrap_width, zcl::t_arena *const temp_arena);
+
+    // Give a wrap width of 0 for no wrapping. Lines are aligned within the wrap width if wrapping, otherwise within the widest line.
+    t_str_layout_mut TextLayoutCreate(const zcl::t_array_rdonly<t_text_span> spans, const zcl::t_f32 wrap_width, const t_text_align align, zcl::t_arena *const arena, zcl::t_arena *const temp_arena, const zcl::t_v2 origin = zcl::k_origin_top_left, const zcl::t_f32 rot = 0.0f, const zcl::t_v2 scale = {1.0f, 1.0f});
+
+    // ==================================================
+
     namespace internal {
         t_rendering_basis *RenderingBasisCreate(const zcl::t_i32 frame_vertex_limit, const t_gfx_ticket_mut gfx_ticket, zcl::t_arena *const arena, zcl::t_arena *const temp_arena);
 
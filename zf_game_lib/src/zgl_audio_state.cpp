@@ -47,11 +47,7 @@ namespace zgl {
         ZCL_ASSERT(g_state.phase != ek_phase_inactive);
         ZCL_ASSERT(TicketCheckValid(ticket));
 
-        for (zcl::t_i32 i = 0; i < k_sound_instance_limit; i++) {
-            if (!zcl::BitsetCheckSet(g_state.snd_insts.activity, i)) {
-                continue;
-            }
-
+        ZCL_BITSET_WALK_SET(g_state.snd_insts.activity, i) {
             SoundDestroy(ticket, {i, g_state.snd_insts.versions[i]});
         }
 
@@ -65,8 +61,8 @@ namespace zgl {
         ZCL_ASSERT(TicketCheckValid(ticket));
 
         if (frozen && g_state.phase == ek_phase_active) {
-            for (zcl::t_i32 i = 0; i < k_sound_instance_limit; i++) {
-                if (!zcl::BitsetCheckSet(g_state.snd_insts.activity, i) || g_state.snd_insts.states[i] != ek_sound_state_playing) {
+            ZCL_BITSET_WALK_SET(g_state.snd_insts.activity, i) {
+                if (g_state.snd_insts.states[i] != ek_sound_state_playing) {
                     continue;
                 }
 
@@ -75,8 +71,8 @@ namespace zgl {
 
             g_state.phase = ek_phase_frozen;
         } else if (!frozen && g_state.phase == ek_phase_frozen) {
-            for (zcl::t_i32 i = 0; i < k_sound_instance_limit; i++) {
-                if (!zcl::BitsetCheckSet(g_state.snd_insts.activity, i) || g_state.snd_insts.states[i] != ek_sound_state_playing) {
+            ZCL_BITSET_WALK_SET(g_state.snd_insts.activity, i) {
+                if (g_state.snd_insts.states[i] != ek_sound_state_playing) {
                     continue;
                 }
 
@@ -96,7 +92,7 @@ namespace zgl {
 
         if (index == -1) {
             // Giving a warning for this instead of fatal error because it's quite an easy thing to hit and can be often recovered from.
-            zcl::LogWarning(ZCL_STR_LITERAL("Trying to create a sound, but the limit has been reached!"));
+            zcl::LogWarning("Trying to create a sound, but the limit has been reached!");
             return false;
         }
 
@@ -385,11 +381,7 @@ namespace zgl {
         const auto ids = zcl::ArenaPushArray<t_sound_id>(arena, zcl::BitsetCountSet(g_state.snd_insts.activity));
         zcl::t_i32 id_index = 0;
 
-        for (zcl::t_i32 i = 0; i < k_sound_instance_limit; i++) {
-            if (!zcl::BitsetCheckSet(g_state.snd_insts.activity, i)) {
-                continue;
-            }
-
+        ZCL_BITSET_WALK_SET(g_state.snd_insts.activity, i) {
             ids[id_index] = {i, g_state.snd_insts.versions[i]};
             id_index++;
         }
@@ -405,11 +397,7 @@ namespace zgl {
             return;
         }
 
-        for (zcl::t_i32 i = 0; i < k_sound_instance_limit; i++) {
-            if (!zcl::BitsetCheckSet(g_state.snd_insts.activity, i)) {
-                continue;
-            }
-
+        ZCL_BITSET_WALK_SET(g_state.snd_insts.activity, i) {
             if (g_state.snd_insts.states[i] != ek_sound_state_playing) {
                 continue;
             }
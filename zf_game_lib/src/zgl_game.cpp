@@ -94,7 +94,7 @@ namespace zgl {
 
                 if (backbuffer_size != screen_size) {
 #ifdef ZCL_DEBUG
-                    zcl::Log(ZCL_STR_LITERAL("Resizing backbuffer from % to %..."), backbuffer_size, screen_size);
+                    zcl::Log("Resizing backbuffer from % to %...", backbuffer_size, screen_size);
 #endif
 
                     internal::BackbufferResize(gfx_ticket, screen_size);
@@ -129,13 +129,13 @@ namespace zgl {
                 };
 
                 if (window_focused && !window_focused_last) {
-                    zcl::Log(ZCL_STR_LITERAL("Window entered focus."));
+                    zcl::Log("Window entered focus.");
 
                     if (config.window_focus_func) {
                         config.window_focus_func(window_focus_func_context);
                     }
                 } else if (!window_focused && window_focused_last) {
-                    zcl::Log(ZCL_STR_LITERAL("Window left focus."));
+                    zcl::Log("Window left focus.");
 
                     if (config.window_focus_func) {
                         config.window_focus_func(window_focus_func_context);
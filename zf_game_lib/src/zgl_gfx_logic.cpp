@@ -1,6 +1,16 @@
 #include <zgl/zgl_gfx_private.h>
 
 namespace zgl {
+    static t_gfx_resource *TextureCreateFromBuiltStream(const t_gfx_ticket_mut gfx_ticket, const zcl::t_stream_view stream_view, t_gfx_resource_group *const group, zcl::t_arena *const temp_arena) {
+        zcl::t_texture_data_mut texture_data;
+
+        if (!zcl::DeserializeTexture(stream_view, temp_arena, &texture_data)) {
+            ZCL_FATAL();
+        }
+
+        return TextureCreate(gfx_ticket, texture_data, group);
+    }
+
     t_gfx_resource *TextureCreateFromBuilt(const t_gfx_ticket_mut gfx_ticket, const zcl::t_str_rdonly file_path, t_gfx_resource_group *const group, zcl::t_arena *const temp_arena) {
         ZCL_ASSERT(TicketCheckValid(gfx_ticket));
 
@@ -10,15 +20,16 @@ namespace zgl {
             ZCL_FATAL();
         }
 
-        zcl::t_texture_data_mut texture_data;
+        ZCL_DEFER({ zcl::FileClose(&file_stream); });
 
-        if (!zcl::DeserializeTexture(zcl::FileStreamGetView(&file_stream), temp_arena, &texture_data)) {
-            ZCL_FATAL();
-        }
+        return TextureCreateFromBuiltStream(gfx_ticket, zcl::FileStreamGetView(&file_stream), group, temp_arena);
+    }
 
-        zcl::FileClose(&file_stream);
+    t_gfx_resource *TextureCreateFromBuiltContents(const t_gfx_ticket_mut gfx_ticket, const zcl::t_array_mut<zcl::t_u8> contents, t_gfx_resource_group *const group, zcl::t_arena *const temp_arena) {
+        ZCL_ASSERT(TicketCheckValid(gfx_ticket));
 
-        return TextureCreate(gfx_ticket, texture_data, group);
+        zcl::t_byte_stream contents_stream = zcl::ByteStreamCreate(contents, zcl::ek_stream_mode_read);
+        return TextureCreateFromBuiltStream(gfx_ticket, zcl::ByteStreamGetView(&contents_stream), group, temp_arena);
     }
 
     t_gfx_resource *TextureCreateFromUnbuilt(const t_gfx_ticket_mut gfx_ticket, const zcl::t_str_rdonly file_path, t_gfx_resource_group *const group, zcl::t_arena *const temp_arena) {
@@ -33,62 +44,60 @@ namespace zgl {
         return TextureCreate(gfx_ticket, texture_data, group);
     }
 
-    t_gfx_resource *ShaderProgCreateFromBuilt(const t_gfx_ticket_mut gfx_ticket, const zcl::t_str_rdonly vertex_shader_file_path, const zcl::t_str_rdonly fragment_shader_file_path, t_gfx_resource_group *const group, zcl::t_arena *const temp_arena) {
-        ZCL_ASSERT(TicketCheckValid(gfx_ticket));
-
-        zcl::t_array_mut<zcl::t_u8> vertex_shader_compiled_bin;
+    static zcl::t_array_mut<zcl::t_u8> ShaderLoadFromBuilt(const zcl::t_str_rdonly file_path, zcl::t_arena *const temp_arena) {
+        zcl::t_file_stream file_stream;
 
-        {
-            zcl::t_file_stream vertex_shader_file_stream;
+        if (!zcl::FileOpen(file_path, zcl::t_file_access_mode::ek_file_access_mode_read, temp_arena, &file_stream)) {
+            ZCL_FATAL();
+        }
 
-            if (!zcl::FileOpen(vertex_shader_file_path, zcl::t_file_access_mode::ek_file_access_mode_read, temp_arena, &vertex_shader_file_stream)) {
-                ZCL_FATAL();
-            }
+        ZCL_DEFER({ zcl::FileClose(&file_stream); });
 
-            if (!zcl::DeserializeShader(zcl::FileStreamGetView(&vertex_shader_file_stream), temp_arena, &vertex_shader_compiled_bin)) {
-                ZCL_FATAL();
-            }
+        zcl::t_array_mut<zcl::t_u8> compiled_bin;
 
-            zcl::FileClose(&vertex_shader_file_stream);
+        if (!zcl::DeserializeShader(zcl::FileStreamGetView(&file_stream), temp_arena, &compiled_bin)) {
+            ZCL_FATAL();
         }
 
-        zcl::t_array_mut<zcl::t_u8> fragment_shader_compiled_bin;
-
-        {
-            zcl::t_file_stream fragment_shader_file_stream;
+        return compiled_bin;
+    }
 
-            if (!zcl::FileOpen(fragment_shader_file_path, zcl::t_file_access_mode::ek_file_access_mode_read, temp_arena, &fragment_shader_file_stream)) {
-                ZCL_FATAL();
-            }
+    static zcl::t_array_mut<zcl::t_u8> ShaderLoadFromBuiltContents(const zcl::t_array_mut<zcl::t_u8> contents, zcl::t_arena *const temp_arena) {
+        zcl::t_byte_stream contents_stream = zcl::ByteStreamCreate(contents, zcl::ek_stream_mode_read);
 
-            if (!zcl::DeserializeShader(zcl::FileStreamGetView(&fragment_shader_file_stream), temp_arena, &fragment_shader_compiled_bin)) {
-                ZCL_FATAL();
-            }
+        zcl::t_array_mut<zcl::t_u8> compiled_bin;
 
-            zcl::FileClose(&fragment_shader_file_stream);
+        if (!zcl::DeserializeShader(zcl::ByteStreamGetView(&contents_stream), temp_arena, &compiled_bin)) {
+            ZCL_FATAL();
         }
 
-        return ShaderProgCreate(gfx_ticket, vertex_shader_compiled_bin, fragment_shader_compiled_bin, group);
+        return compiled_bin;
     }
 
-    t_font FontCreateFromBuilt(const t_gfx_ticket_mut gfx_ticket, const zcl::t_str_rdonly file_path, t_gfx_resource_group *const resource_group, zcl::t_arena *const temp_arena) {
+    t_gfx_resource *ShaderProgCreateFromBuilt(const t_gfx_ticket_mut gfx_ticket, const zcl::t_str_rdonly vertex_shader_file_path, const zcl::t_str_rdonly fragment_shader_file_path, t_gfx_resource_group *const group, zcl::t_arena *const temp_arena) {
         ZCL_ASSERT(TicketCheckValid(gfx_ticket));
 
-        zcl::t_font_arrangement arrangement;
-        zcl::t_array_mut<zcl::t_font_atlas_pixels_r8> atlas_pixels_arr;
+        const zcl::t_array_mut<zcl::t_u8> vertex_shader_compiled_bin = ShaderLoadFromBuilt(vertex_shader_file_path, temp_arena);
+        const zcl::t_array_mut<zcl::t_u8> fragment_shader_compiled_bin = ShaderLoadFromBuilt(fragment_shader_file_path, temp_arena);
+
+        return ShaderProgCreate(gfx_ticket, vertex_shader_compiled_bin, fragment_shader_compiled_bin, group);
+    }
+
+    t_gfx_resource *ShaderProgCreateFromBuiltContents(const t_gfx_ticket_mut gfx_ticket, const zcl::t_array_mut<zcl::t_u8> vertex_shader_contents, const zcl::t_array_mut<zcl::t_u8> fragment_shader_contents, t_gfx_resource_group *const group, zcl::t_arena *const temp_arena) {
+        ZCL_ASSERT(TicketCheckValid(gfx_ticket));
 
-        {
-            zcl::t_file_stream file_stream;
+        const zcl::t_array_mut<zcl::t_u8> vertex_shader_compiled_bin = ShaderLoadFromBuiltContents(vertex_shader_contents, temp_arena);
+        const zcl::t_array_mut<zcl::t_u8> fragment_shader_compiled_bin = ShaderLoadFromBuiltContents(fragment_shader_contents, temp_arena);
 
-            if (!zcl::FileOpen(file_path, zcl::t_file_access_mode::ek_file_access_mode_read, temp_arena, &file_stream)) {
-                ZCL_FATAL();
-            }
+        return ShaderProgCreate(gfx_ticket, vertex_shader_compiled_bin, fragment_shader_compiled_bin, group);
+    }
 
-            if (!zcl::DeserializeFont(zcl::FileStreamGetView(&file_stream), GFXResourceGroupGetArena(gfx_ticket, resource_group), temp_arena, temp_arena, &arrangement, &atlas_pixels_arr)) {
-                ZCL_FATAL();
-            }
+    static t_font FontCreateFromBuiltStream(const t_gfx_ticket_mut gfx_ticket, const zcl::t_stream_view stream_view, t_gfx_resource_group *const resource_group, zcl::t_arena *const temp_arena) {
+        zcl::t_font_arrangement arrangement;
+        zcl::t_array_mut<zcl::t_font_atlas_pixels_r8> atlas_pixels_arr;
 
-            zcl::FileClose(&file_stream);
+        if (!zcl::DeserializeFont(stream_view, GFXResourceGroupGetArena(gfx_ticket, resource_group), temp_arena, temp_arena, &arrangement, &atlas_pixels_arr)) {
+            ZCL_FATAL();
         }
 
         const auto atlas_textures = zcl::ArenaPushArray<t_gfx_resource *>(GFXResourceGroupGetArena(gfx_ticket, resource_group), atlas_pixels_arr.len);
@@ -109,6 +118,27 @@ namespace zgl {
         };
     }
 
+    t_font FontCreateFromBuilt(const t_gfx_ticket_mut gfx_ticket, const zcl::t_str_rdonly file_path, t_gfx_resource_group *const resource_group, zcl::t_arena *const temp_arena) {
+        ZCL_ASSERT(TicketCheckValid(gfx_ticket));
+
+        zcl::t_file_stream file_stream;
+
+        if (!zcl::FileOpen(file_path, zcl::t_file_access_mode::ek_file_access_mode_read, temp_arena, &file_stream)) {
+            ZCL_FATAL();
+        }
+
+        ZCL_DEFER({ zcl::FileClose(&file_stream); });
+
+        return FontCreateFromBuiltStream(gfx_ticket, zcl::FileStreamGetView(&file_stream), resource_group, temp_arena);
+    }
+
+    t_font FontCreateFromBuiltContents(const t_gfx_ticket_mut gfx_ticket, const zcl::t_array_mut<zcl::t_u8> contents, t_gfx_resource_group *const resource_group, zcl::t_arena *const temp_arena) {
+        ZCL_ASSERT(TicketCheckValid(gfx_ticket));
+
+        zcl::t_byte_stream contents_stream = zcl::ByteStreamCreate(contents, zcl::ek_stream_mode_read);
+        return FontCreateFromBuiltStream(gfx_ticket, zcl::ByteStreamGetView(&contents_stream), resource_group, temp_arena);
+    }
+
     t_font FontCreateFromUnbuilt(const t_gfx_ticket_mut gfx_ticket, const zcl::t_str_rdonly file_path, const zcl::t_i32 height, zcl::t_code_point_bitset *const code_pts, t_gfx_resource_group *const resource_group, zcl::t_arena *const temp_arena) {
         ZCL_ASSERT(TicketCheckValid(gfx_ticket));
 
@@ -88,6 +88,28 @@ namespace zgl {
         return TicketCreate();
     }
 
+    t_gfx_ticket_mut internal::GFXStartupHeadless(const zcl::t_v2_i backbuffer_size) {
+        ZCL_ASSERT(g_state.phase == ek_phase_inactive);
+        ZCL_ASSERT(backbuffer_size.x > 0 && backbuffer_size.y > 0);
+
+        g_state.phase = ek_phase_active_but_not_midframe;
+
+        bgfx::Init bgfx_init = {};
+
+        bgfx_init.type = bgfx::RendererType::Noop;
+
+        bgfx_init.resolution.width = static_cast<zcl::t_u32>(backbuffer_size.x);
+        bgfx_init.resolution.height = static_cast<zcl::t_u32>(backbuffer_size.y);
+
+        g_state.backbuffer_size_cache = backbuffer_size;
+
+        if (!bgfx::init(bgfx_init)) {
+            ZCL_FATAL();
+        }
+
+        return TicketCreate();
+    }
+
     void internal::GFXShutdown(const t_gfx_ticket_mut gfx_ticket) {
         ZCL_ASSERT(g_state.phase != ek_phase_inactive);
         ZCL_ASSERT(TicketCheckValid(gfx_ticket));
@@ -74,7 +74,7 @@ namespace zgl {
                 const auto input_state = static_cast<t_input_state *>(glfwGetWindowUserPointer(window));
 
                 if (!internal::TextSubmitCodePoints(input_state, code_pt)) {
-                    zcl::LogWarning(ZCL_STR_LITERAL("Tried to submit input text code point, but there is insufficient space!"));
+                    zcl::LogWarning("Tried to submit input text code point, but there is insufficient space!");
                 }
             };
 
@@ -204,7 +204,7 @@ namespace zgl {
         ZCL_ASSERT(g_state.active);
         ZCL_ASSERT(TicketCheckValid(platform_ticket));
 
-        zcl::Log(ZCL_STR_LITERAL("Window close explicitly requested..."));
+        zcl::Log("Window close explicitly requested...");
         return glfwSetWindowShouldClose(g_state.glfw_window, true);
     }
 
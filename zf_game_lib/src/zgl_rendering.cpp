@@ -439,9 +439,9 @@ namespace zgl {
                     continue;
                 }
 
-                zcl::t_font_glyph_info *glyph_info;
+                const zcl::t_font_glyph_info *glyph_info;
 
-                if (!zcl::HashMapFind(&font_arrangement.code_pts_to_glyph_infos, step.code_pt, &glyph_info)) {
+                if (!zcl::FontFindGlyphInfo(font_arrangement, step.code_pt, &glyph_info)) {
                     ZCL_FATAL();
                 }
 
@@ -480,6 +480,112 @@ namespace zgl {
         };
     }
 
+    t_str_render_info_mut CalcStrRenderInfoShaped(const zcl::t_str_rdonly str, const zcl::t_font_arrangement &font_arrangement, const zcl::t_v2 origin, const zcl::t_font_shaper shaper, zcl::t_arena *const arena, zcl::t_arena *const temp_arena) {
+        ZCL_ASSERT(zcl::StrCheckValidUTF8(str));
+        ZCL_ASSERT(zcl::OriginCheckValid(origin));
+
+        struct t_str_meta {
+            zcl::t_i32 len;
+            zcl::t_i32 line_cnt;
+            zcl::t_b8 needs_shaping;
+        };
+
+        const t_str_meta str_meta = [str]() {
+            t_str_meta result = {.line_cnt = 1};
+
+            ZCL_STR_WALK (str, step) {
+                result.len++;
+
+                if (step.code_pt == '\n') {
+                    result.line_cnt++;
+                } else if (step.code_pt >= zcl::k_font_shaping_code_point_threshold) {
+                    result.needs_shaping = true;
+                }
+            }
+
+            return result;
+        }();
+
+        if (!str_meta.needs_shaping) {
+            return CalcStrRenderInfo(str, font_arrangement, origin, arena);
+        }
+
+        const auto chr_offsets = zcl::ArenaPushArray<zcl::t_v2>(arena, str_meta.len);
+        const auto line_code_pts = zcl::ArenaPushArray<zcl::t_code_point>(temp_arena, str_meta.len);
+        const auto line_widths = zcl::ArenaPushArray<zcl::t_f32>(temp_arena, str_meta.line_cnt);
+
+        zcl::t_f32 width = 0.0f;
+
+        {
+            zcl::t_i32 chr_index = 0;
+            zcl::t_i32 line_index = 0;
+            zcl::t_i32 line_begin_chr_index = 0;
+
+            const auto shape_line = [&]() {
+                const zcl::t_font_shaped_line shaped_line = shaper(zcl::ArraySlice(line_code_pts, 0, chr_index - line_begin_chr_index), font_arrangement, temp_arena);
+                const zcl::t_f32 line_y = static_cast<zcl::t_f32>(line_index * font_arrangement.line_height);
+
+                for (zcl::t_i32 i = 0; i < shaped_line.glyphs.len; i++) {
+                    const zcl::t_font_shaped_glyph glyph = shaped_line.glyphs[i];
+
+                    const zcl::t_font_glyph_info *glyph_info;
+
+                    if (!zcl::FontFindGlyphInfo(font_arrangement, glyph.code_pt, &glyph_info)) {
+                        ZCL_FATAL();
+                    }
+
+                    chr_offsets[line_begin_chr_index + glyph.src_index] = zcl::V2IToF(glyph.pos + glyph_info->offs) + zcl::t_v2{0.0f, line_y};
+                }
+
+                line_widths[line_index] = static_cast<zcl::t_f32>(shaped_line.width);
+                width = zcl::CalcMax(width, line_widths[line_index]);
+            };
+
+            ZCL_STR_WALK (str, step) {
+                if (step.code_pt == '\n') {
+                    shape_line();
+
+                    // The line break itself is never drawn, but give it a sensible offset anyway.
+                    chr_offsets[chr_index] = {line_widths[line_index], static_cast<zcl::t_f32>(line_index * font_arrangement.line_height)};
+
+                    chr_index++;
+                    line_index++;
+                    line_begin_chr_index = chr_index;
+
+                    continue;
+                }
+
+                line_code_pts[chr_index - line_begin_chr_index] = step.code_pt;
+                chr_index++;
+            }
+
+            shape_line();
+        }
+
+        const zcl::t_f32 height = static_cast<zcl::t_f32>(str_meta.line_cnt * font_arrangement.line_height);
+
+        {
+            zcl::t_i32 line_index = 0;
+            zcl::t_i32 chr_index = 0;
+
+            ZCL_STR_WALK (str, step) {
+                chr_offsets[chr_index].x -= line_widths[line_index] * origin.x;
+                chr_offsets[chr_index].y -= height * origin.y;
+
+                if (step.code_pt == '\n') {
+                    line_index++;
+                }
+
+                chr_index++;
+            }
+        }
+
+        return {
+            .chr_offsets = chr_offsets,
+            .size = {width, height},
+        };
+    }
+
     zcl::t_poly_mut CalcStrRenderCollider(const zcl::t_str_rdonly str, const t_str_render_info_rdonly render_info, const t_font &font, const zcl::t_v2 pos, zcl::t_arena *const arena, const zcl::t_v2 origin, const zcl::t_f32 rot, const zcl::t_v2 scale) {
         ZCL_ASSERT(zcl::StrCheckValidUTF8(str));
         ZCL_ASSERT(zcl::OriginCheckValid(origin));
@@ -502,6 +608,34 @@ namespace zgl {
         return zcl::RectCreateF(pos - (zcl::CalcCompwiseProd(render_info.size, origin)), render_info.size);
     }
 
+    static zcl::t_static_array<t_gfx_triangle, 2> StrChrTrianglesCalc(const zcl::t_font_glyph_info &glyph_info, const zcl::t_v2 chr_pos, const zcl::t_color_rgba32f color, const zcl::t_f32 rot, const zcl::t_v2 scale) {
+        zcl::t_static_array<zcl::t_v2, 4> quad_pts;
+
+        zcl::t_arena *const quad_pts_arena = zcl::ArenaCreateWrapping(zcl::ToBytes(&quad_pts));
+        ZCL_DEFER({ zcl::ArenaDestroy(quad_pts_arena); });
+
+        const zcl::t_poly_mut quad_poly = zcl::PolyCreateQuadRotated(chr_pos, zcl::CalcCompwiseProd(zcl::V2IToF(zcl::RectGetSize(glyph_info.atlas_rect)), scale), {}, rot, quad_pts_arena);
+
+        const zcl::t_rect_f uv_rect = TextureUVRectCalc(glyph_info.atlas_rect, zcl::k_font_atlas_texture_size);
+
+        return {{
+            {
+                .vertices = {{
+                    {.pos = quad_poly.pts[0], .blend = color, .uv = zcl::RectGetTopLeft(uv_rect)},
+                    {.pos = quad_poly.pts[1], .blend = color, .uv = zcl::RectGetTopRight(uv_rect)},
+                    {.pos = quad_poly.pts[3], .blend = color, .uv = zcl::RectGetBottomLeft(uv_rect)},
+                }},
+            },
+            {
+                .vertices = {{
+                    {.pos = quad_poly.pts[3], .blend = color, .uv = zcl::RectGetBottomLeft(uv_rect)},
+                    {.pos = quad_poly.pts[1], .blend = color, .uv = zcl::RectGetTopRight(uv_rect)},
+                    {.pos = quad_poly.pts[2], .blend = color, .uv = zcl::RectGetBottomRight(uv_rect)},
+                }},
+            },
+        }};
+    }
+
     void RendererSubmitStr(const t_rendering_context rc, const zcl::t_str_rdonly str, const t_str_render_info_rdonly render_info, const t_font &font, const zcl::t_v2 pos, const zcl::t_color_rgba32f color, const zcl::t_f32 rot, const zcl::t_v2 scale) {
         ZCL_ASSERT(zcl::StrCheckValidUTF8(str));
 
@@ -520,43 +654,522 @@ namespace zgl {
                 continue;
             }
 
-            zcl::t_font_glyph_info *glyph_info;
+            const zcl::t_font_glyph_info *glyph_info;
 
-            if (!zcl::HashMapFind(&font.arrangement.code_pts_to_glyph_infos, step.code_pt, &glyph_info)) {
+            if (!zcl::FontFindGlyphInfo(font.arrangement, step.code_pt, &glyph_info)) {
                 ZCL_FATAL();
             }
 
             const zcl::t_v2 chr_pos = pos + zcl::CalcLengthDir(render_info.chr_offsets[chr_index].x * scale.x, rot) + zcl::CalcLengthDir(render_info.chr_offsets[chr_index].y * scale.y, rot + (zcl::k_pi / 2.0f));
 
-            zcl::t_static_array<zcl::t_v2, 4> quad_pts;
+            const auto triangles = StrChrTrianglesCalc(*glyph_info, chr_pos, color, rot, scale);
 
-            zcl::t_arena *const quad_pts_arena = zcl::ArenaCreateWrapping(zcl::ToBytes(&quad_pts));
-            ZCL_DEFER({ zcl::ArenaDestroy(quad_pts_arena); });
+            RendererSubmit(rc, zcl::ArrayToNonstatic(&triangles), font.atlas_textures[glyph_info->atlas_index]);
+        }
 
-            const zcl::t_poly_mut quad_poly = zcl::PolyCreateQuadRotated(chr_pos, zcl::CalcCompwiseProd(zcl::V2IToF(zcl::RectGetSize(glyph_info->atlas_rect)), scale), {}, rot, quad_pts_arena);
+        RendererSetShaderProg(rc, nullptr);
+    }
 
-            const zcl::t_rect_f uv_rect = TextureUVRectCalc(glyph_info->atlas_rect, zcl::k_font_atlas_texture_size);
+    t_str_layout_mut StrLayoutCreate(const zcl::t_str_rdonly str, const t_font &font, const zcl::t_color_rgba32f color, zcl::t_arena *const arena, zcl::t_arena *const temp_arena, const zcl::t_v2 origin, const zcl::t_f32 rot, const zcl::t_v2 scale) {
+        ZCL_ASSERT(zcl::StrCheckValidUTF8(str));
+        ZCL_ASSERT(zcl::OriginCheckValid(origin));
 
-            const zcl::t_static_array<t_gfx_triangle, 2> triangles = {{
-                {
-                    .vertices = {{
-                        {.pos = quad_poly.pts[0], .blend = color, .uv = zcl::RectGetTopLeft(uv_rect)},
-                        {.pos = quad_poly.pts[1], .blend = color, .uv = zcl::RectGetTopRight(uv_rect)},
-                        {.pos = quad_poly.pts[3], .blend = color, .uv = zcl::RectGetBottomLeft(uv_rect)},
-                    }},
-                },
-                {
-                    .vertices = {{
-                        {.pos = quad_poly.pts[3], .blend = color, .uv = zcl::RectGetBottomLeft(uv_rect)},
-                        {.pos = quad_poly.pts[1], .blend = color, .uv = zcl::RectGetTopRight(uv_rect)},
-                        {.pos = quad_poly.pts[2], .blend = color, .uv = zcl::RectGetBottomRight(uv_rect)},
-                    }},
-                },
-            }};
+        if (zcl::StrCheckEmpty(str)) {
+            return {};
+        }
 
-            RendererSubmit(rc, zcl::ArrayToNonstatic(&triangles), font.atlas_textures[glyph_info->atlas_index]);
+        const t_str_render_info_rdonly render_info = CalcStrRenderInfo(str, font.arrangement, origin, temp_arena);
+
+        const zcl::t_i32 glyph_cnt = [str]() {
+            zcl::t_i32 result = 0;
+
+            ZCL_STR_WALK (str, step) {
+                if (step.code_pt != ' ' && step.code_pt != '\n') {
+                    result++;
+                }
+            }
+
+            return result;
+        }();
+
+        if (glyph_cnt == 0) {
+            return {.size = render_info.size};
+        }
+
+        const auto triangles = zcl::ArenaPushArray<t_gfx_triangle>(arena, 2 * glyph_cnt);
+
+        // Worst case is a run per glyph, so allocate for that in the temporary arena and clone over only what was used.
+        const auto runs_temp = zcl::ArenaPushArray<t_str_layout_run>(temp_arena, glyph_cnt);
+        zcl::t_i32 run_cnt = 0;
+
+        zcl::t_i32 chr_index = 0;
+        zcl::t_i32 glyph_index = 0;
+
+        ZCL_STR_WALK (str, step) {
+            ZCL_DEFER({ chr_index++; });
+
+            if (step.code_pt == ' ' || step.code_pt == '\n') {
+                continue;
+            }
+
+            const zcl::t_font_glyph_info *glyph_info;
+
+            if (!zcl::FontFindGlyphInfo(font.arrangement, step.code_pt, &glyph_info)) {
+                ZCL_FATAL();
+            }
+
+            const zcl::t_v2 chr_pos = zcl::CalcLengthDir(render_info.chr_offsets[chr_index].x * scale.x, rot) + zcl::CalcLengthDir(render_info.chr_offsets[chr_index].y * scale.y, rot + (zcl::k_pi / 2.0f));
+
+            const auto chr_triangles = StrChrTrianglesCalc(*glyph_info, chr_pos, color, rot, scale);
+            triangles[(2 * glyph_index) + 0] = chr_triangles[0];
+            triangles[(2 * glyph_index) + 1] = chr_triangles[1];
+
+            const t_gfx_resource *const texture = font.atlas_textures[glyph_info->atlas_index];
+
+            if (run_cnt == 0 || runs_temp[run_cnt - 1].texture != texture) {
+                runs_temp[run_cnt] = {.texture = texture};
+                run_cnt++;
+            }
+
+            runs_temp[run_cnt - 1].triangle_cnt += 2;
+
+            glyph_index++;
+        }
+
+        return {
+            .triangles = triangles,
+            .runs = zcl::ArenaPushArrayClone(arena, zcl::ArraySlice(runs_temp, 0, run_cnt)),
+            .size = render_info.size,
+        };
+    }
+
+    void RendererSubmitStrLayout(const t_rendering_context rc, const t_str_layout_rdonly layout, const zcl::t_v2 pos) {
+        ZCL_ASSERT(rc.state->pass_index != -1 && "A pass must be set before submitting primitives!");
+
+        if (layout.triangles.len == 0) {
+            return;
+        }
+
+        RendererSetShaderProg(rc, rc.basis->shader_progs[ek_renderer_builtin_shader_prog_id_str]);
+
+        zcl::t_i32 triangle_index = 0;
+
+        for (zcl::t_i32 run_index = 0; run_index < layout.runs.len; run_index++) {
+            const t_str_layout_run run = layout.runs[run_index];
+            const zcl::t_i32 triangle_end_index = triangle_index + run.triangle_cnt;
+
+            // Goes straight into the batch rather than through RendererSubmit, since a run can exceed the batch limit and the triangles were already validated on creation.
+            while (triangle_index < triangle_end_index) {
+                if (run.texture != rc.state->batch.texture || rc.state->batch.vertex_cnt + 3 > k_batch_vertex_limit) {
+                    RendererFlush(rc);
+                    rc.state->batch.texture = run.texture;
+                }
+
+                const zcl::t_i32 triangle_cnt = zcl::CalcMin(triangle_end_index - triangle_index, (k_batch_vertex_limit - rc.state->batch.vertex_cnt) / 3);
+
+                for (zcl::t_i32 i = 0; i < triangle_cnt; i++) {
+                    const t_gfx_triangle &triangle = layout.triangles[triangle_index + i];
+                    const zcl::t_i32 offs = rc.state->batch.vertex_cnt + (3 * i);
+
+                    for (zcl::t_i32 j = 0; j < 3; j++) {
+                        t_gfx_vertex vert = triangle.vertices[j];
+                        vert.pos += pos;
+                        rc.state->batch.vertices[offs + j] = vert;
+                    }
+                }
+
+                rc.state->batch.vertex_cnt += 3 * triangle_cnt;
+                triangle_index += triangle_cnt;
+            }
         }
 
         RendererSetShaderProg(rc, nullptr);
     }
+
+    struct t_text_item {
+        zcl::t_i32 span_index;
+        zcl::t_code_point code_pt;
+        const zcl::t_font_glyph_info *glyph_info; // nullptr for spaces and line breaks.
+
+        zcl::t_f32 kerning; // Applied before this item if it is not at the beginning of a line.
+        zcl::t_f32 adv;
+
+        zcl::t_v2 pos; // Only set once the lines are arranged.
+    };
+
+    struct t_text_line {
+        zcl::t_i32 item_begin_index;
+        zcl::t_i32 item_end_index; // Excludes trailing spaces.
+        zcl::t_f32 width;
+        zcl::t_f32 height;
+        zcl::t_f32 ascent; // The largest of the ascents of the fonts on the line, which puts all of them on the same baseline.
+        zcl::t_b8 ended_explicitly;
+    };
+
+    struct t_text_arrangement {
+        zcl::t_array_mut<t_text_item> items;
+        zcl::t_array_mut<t_text_line> lines;
+        t_text_metrics metrics;
+    };
+
+    static zcl::t_f32 TextLineCalcWidth(const zcl::t_array_rdonly<t_text_item> items, const zcl::t_i32 begin_index, const zcl::t_i32 end_index) {
+        zcl::t_f32 result = 0.0f;
+
+        for (zcl::t_i32 i = begin_index; i < end_index; i++) {
+            if (i > begin_index) {
+                result += items[i].kerning;
+            }
+
+            result += items[i].adv;
+        }
+
+        return result;
+    }
+
+    static t_text_arrangement TextArrange(const zcl::t_array_rdonly<t_text_span> spans, const zcl::t_f32 wrap_width, const t_text_align align, zcl::t_arena *const temp_arena) {
+        ZCL_ASSERT(wrap_width >= 0.0f);
+
+        const zcl::t_i32 item_cnt = [spans]() {
+            zcl::t_i32 result = 0;
+
+            for (zcl::t_i32 i = 0; i < spans.len; i++) {
+                ZCL_ASSERT(zcl::StrCheckValidUTF8(spans[i].str));
+                result += zcl::StrCalcLen(spans[i].str);
+            }
+
+            return result;
+        }();
+
+        if (item_cnt == 0) {
+            return {};
+        }
+
+        const auto items = zcl::ArenaPushArray<t_text_item>(temp_arena, item_cnt);
+
+        // Resolve glyphs and advances up front so that line breaking never needs to go back to the font.
+        {
+            zcl::t_i32 item_index = 0;
+
+            for (zcl::t_i32 span_index = 0; span_index < spans.len; span_index++) {
+                const zcl::t_font_arrangement &font_arrangement = spans[span_index].font->arrangement;
+
+                ZCL_STR_WALK (spans[span_index].str, step) {
+                    t_text_item &item = items[item_index];
+                    item.span_index = span_index;
+                    item.code_pt = step.code_pt;
+
+                    if (step.code_pt != '\n') {
+                        const zcl::t_font_glyph_info *glyph_info;
+
+                        if (!zcl::FontFindGlyphInfo(font_arrangement, step.code_pt, &glyph_info)) {
+                            ZCL_FATAL();
+                        }
+
+                        item.adv = static_cast<zcl::t_f32>(glyph_info->adv);
+
+                        if (step.code_pt != ' ') {
+                            item.glyph_info = glyph_info;
+                        }
+
+                        const t_text_item *const item_prev = item_index > 0 ? &items[item_index - 1] : nullptr;
+
+                        if (item_prev && item_prev->code_pt != '\n' && spans[item_prev->span_index].font == spans[span_index].font && font_arrangement.has_kernings) {
+                            zcl::t_i32 *kerning;
+
+                            if (zcl::HashMapFind(&font_arrangement.code_pt_pairs_to_kernings, {item_prev->code_pt, step.code_pt}, &kerning)) {
+                                item.kerning = static_cast<zcl::t_f32>(*kerning);
+                            }
+                        }
+                    }
+
+                    item_index++;
+                }
+            }
+        }
+
+        // There can be at most one line per item, plus the trailing one.
+        const auto lines = zcl::ArenaPushArray<t_text_line>(temp_arena, item_cnt + 1);
+        zcl::t_i32 line_cnt = 0;
+
+        // Greedily break lines.
+        {
+            zcl::t_i32 line_begin_index = 0;
+            zcl::t_f32 pen_x = 0.0f;
+
+            // Mixed fonts share a baseline, so the line has to fit the tallest of them above it and the deepest of them below it.
+            zcl::t_f32 line_ascent = 0.0f;
+            zcl::t_f32 line_descent = 0.0f;
+
+            const auto fit_font = [&](const zcl::t_font_arrangement &font_arrangement) {
+                line_ascent = zcl::CalcMax(line_ascent, static_cast<zcl::t_f32>(font_arrangement.ascent));
+                line_descent = zcl::CalcMax(line_descent, static_cast<zcl::t_f32>(font_arrangement.line_height - font_arrangement.ascent));
+            };
+
+            zcl::t_i32 break_index = -1; // Where the next line would begin if breaking at the last run of spaces.
+            zcl::t_f32 break_width = 0.0f; // Width of the line up to that run of spaces.
+
+            const auto close_line = [&](const zcl::t_i32 end_index, const zcl::t_f32 width, const zcl::t_b8 explicitly) {
+                lines[line_cnt] = {
+                    .item_begin_index = line_begin_index,
+                    .item_end_index = end_index,
+                    .width = width,
+                    .height = line_ascent + line_descent,
+                    .ascent = line_ascent,
+                    .ended_explicitly = explicitly,
+                };
+
+                line_cnt++;
+            };
+
+            for (zcl::t_i32 i = 0; i < items.len; i++) {
+                const t_text_item &item = items[i];
+                const zcl::t_font_arrangement &item_font_arrangement = spans[item.span_index].font->arrangement;
+
+                if (item.code_pt == '\n') {
+                    fit_font(item_font_arrangement);
+
+                    zcl::t_i32 end_index = i;
+
+                    while (end_index > line_begin_index && items[end_index - 1].code_pt == ' ') {
+                        end_index--;
+                    }
+
+                    close_line(end_index, end_index == i ? pen_x : break_width, true);
+
+                    line_begin_index = i + 1;
+                    pen_x = 0.0f;
+                    line_ascent = 0.0f;
+                    line_descent = 0.0f;
+                    break_index = -1;
+
+                    continue;
+                }
+
+                if (item.code_pt == ' ') {
+                    if (i == line_begin_index || items[i - 1].code_pt != ' ') {
+                        break_width = pen_x;
+                    }
+
+                    pen_x += (i > line_begin_index ? item.kerning : 0.0f) + item.adv;
+                    fit_font(item_font_arrangement);
+                    break_index = i + 1;
+
+                    continue;
+                }
+
+                const zcl::t_f32 item_right = pen_x + (i > line_begin_index ? item.kerning : 0.0f) + item.adv;
+
+                if (wrap_width > 0.0f && item_right > wrap_width && i > line_begin_index) {
+                    // Where the line would end if broken at the last run of spaces. If those spaces begin the line, breaking there would leave it empty.
+                    zcl::t_i32 break_end_index = break_index;
+
+                    while (break_end_index > line_begin_index && items[break_end_index - 1].code_pt == ' ') {
+                        break_end_index--;
+                    }
+
+                    if (break_end_index > line_begin_index) {
+                        // Move everything after the last run of spaces down to a new line, dropping the spaces.
+                        close_line(break_end_index, break_width, false);
+
+                        line_begin_index = break_index;
+                        pen_x = TextLineCalcWidth(items, line_begin_index, i);
+                        line_ascent = 0.0f;
+                        line_descent = 0.0f;
+
+                        for (zcl::t_i32 j = line_begin_index; j < i; j++) {
+                            fit_font(spans[items[j].span_index].font->arrangement);
+                        }
+                    } else {
+                        // The word alone is too wide, so break it where it overflows.
+                        close_line(i, pen_x, false);
+
+                        line_begin_index = i;
+                        pen_x = 0.0f;
+                        line_ascent = 0.0f;
+                        line_descent = 0.0f;
+                    }
+
+                    break_index = -1;
+                }
+
+                pen_x += (i > line_begin_index ? item.kerning : 0.0f) + item.adv;
+                fit_font(item_font_arrangement);
+            }
+
+            {
+                zcl::t_i32 end_index = items.len;
+
+                while (end_index > line_begin_index && items[end_index - 1].code_pt == ' ') {
+                    end_index--;
+                }
+
+                if (line_begin_index == items.len) {
+                    // Empty line following a trailing line break.
+                    fit_font(spans[items[items.len - 1].span_index].font->arrangement);
+                }
+
+                close_line(end_index, end_index == items.len ? pen_x : TextLineCalcWidth(items, line_begin_index, end_index), false);
+            }
+        }
+
+        t_text_metrics metrics = {.line_cnt = line_cnt};
+
+        for (zcl::t_i32 i = 0; i < line_cnt; i++) {
+            metrics.widest_line_width = zcl::CalcMax(metrics.widest_line_width, lines[i].width);
+            metrics.size.y += lines[i].height;
+        }
+
+        metrics.size.x = wrap_width > 0.0f ? wrap_width : metrics.widest_line_width;
+
+        // Position items within their lines.
+        {
+            zcl::t_f32 line_y = 0.0f;
+
+            for (zcl::t_i32 i = 0; i < line_cnt; i++) {
+                const t_text_line &line = lines[i];
+                const zcl::t_f32 space_left = metrics.size.x - line.width;
+
+                zcl::t_f32 pen_x = 0.0f;
+                zcl::t_f32 space_extra = 0.0f;
+
+                switch (align) {
+                    case ek_text_align_left: {
+                        break;
+                    }
+
+                    case ek_text_align_center: {
+                        pen_x = space_left * 0.5f;
+                        break;
+                    }
+
+                    case ek_text_align_right: {
+                        pen_x = space_left;
+                        break;
+                    }
+
+                    case ek_text_align_justified: {
+                        if (line.ended_explicitly || i == line_cnt - 1) {
+                            break;
+                        }
+
+                        zcl::t_i32 gap_cnt = 0;
+
+                        for (zcl::t_i32 j = line.item_begin_index; j < line.item_end_index; j++) {
+                            if (items[j].code_pt == ' ') {
+                                gap_cnt++;
+                            }
+                        }
+
+                        if (gap_cnt > 0) {
+                            space_extra = space_left / static_cast<zcl::t_f32>(gap_cnt);
+                        }
+
+                        break;
+                    }
+
+                    default: {
+                        ZCL_UNREACHABLE();
+                    }
+                }
+
+                for (zcl::t_i32 j = line.item_begin_index; j < line.item_end_index; j++) {
+                    t_text_item &item = items[j];
+
+                    if (j > line.item_begin_index) {
+                        pen_x += item.kerning;
+                    }
+
+                    // Glyph offsets already include their own font's ascent, so only the difference from the line's is needed to reach the shared baseline.
+                    item.pos = {pen_x, line_y + line.ascent - static_cast<zcl::t_f32>(spans[item.span_index].font->arrangement.ascent)};
+
+                    if (item.glyph_info) {
+                        item.pos += zcl::V2IToF(item.glyph_info->offs);
+                    }
+
+                    pen_x += item.adv;
+
+                    if (item.code_pt == ' ') {
+                        pen_x += space_extra;
+                    }
+                }
+
+                line_y += line.height;
+            }
+        }
+
+        return {
+            .items = items,
+            .lines = zcl::ArraySlice(lines, 0, line_cnt),
+            .metrics = metrics,
+        };
+    }
+
+    t_text_metrics TextMeasure(const zcl::t_array_rdonly<t_text_span> spans, const zcl::t_f32 wrap_width, zcl::t_arena *const temp_arena) {
+        return TextArrange(spans, wrap_width, ek_text_align_left, temp_arena).metrics;
+    }
+
+    t_str_layout_mut TextLayoutCreate(const zcl::t_array_rdonly<t_text_span> spans, const zcl::t_f32 wrap_width, const t_text_align align, zcl::t_arena *const arena, zcl::t_arena *const temp_arena, const zcl::t_v2 origin, const zcl::t_f32 rot, const zcl::t_v2 scale) {
+        ZCL_ASSERT(zcl::OriginCheckValid(origin));
+
+        const t_text_arrangement arrangement = TextArrange(spans, wrap_width, align, temp_arena);
+
+        zcl::t_i32 glyph_cnt = 0;
+
+        for (zcl::t_i32 i = 0; i < arrangement.lines.len; i++) {
+            for (zcl::t_i32 j = arrangement.lines[i].item_begin_index; j < arrangement.lines[i].item_end_index; j++) {
+                if (arrangement.items[j].glyph_info) {
+                    glyph_cnt++;
+                }
+            }
+        }
+
+        if (glyph_cnt == 0) {
+            return {.size = arrangement.metrics.size};
+        }
+
+        const auto triangles = zcl::ArenaPushArray<t_gfx_triangle>(arena, 2 * glyph_cnt);
+
+        const auto runs_temp = zcl::ArenaPushArray<t_str_layout_run>(temp_arena, glyph_cnt);
+        zcl::t_i32 run_cnt = 0;
+
+        const zcl::t_v2 origin_offs = zcl::CalcCompwiseProd(arrangement.metrics.size, origin);
+
+        zcl::t_i32 glyph_index = 0;
+
+        for (zcl::t_i32 i = 0; i < arrangement.lines.len; i++) {
+            for (zcl::t_i32 j = arrangement.lines[i].item_begin_index; j < arrangement.lines[i].item_end_index; j++) {
+                const t_text_item &item = arrangement.items[j];
+
+                if (!item.glyph_info) {
+                    continue;
+                }
+
+                const t_text_span &span = spans[item.span_index];
+
+                const zcl::t_v2 offs = item.pos - origin_offs;
+                const zcl::t_v2 chr_pos = zcl::CalcLengthDir(offs.x * scale.x, rot) + zcl::CalcLengthDir(offs.y * scale.y, rot + (zcl::k_pi / 2.0f));
+
+                const auto chr_triangles = StrChrTrianglesCalc(*item.glyph_info, chr_pos, span.color, rot, scale);
+                triangles[(2 * glyph_index) + 0] = chr_triangles[0];
+                triangles[(2 * glyph_index) + 1] = chr_triangles[1];
+
+                const t_gfx_resource *const texture = span.font->atlas_textures[item.glyph_info->atlas_index];
+
+                if (run_cnt == 0 || runs_temp[run_cnt - 1].texture != texture) {
+                    runs_temp[run_cnt] = {.texture = texture};
+                    run_cnt++;
+                }
+
+                runs_temp[run_cnt - 1].triangle_cnt += 2;
+
+                glyph_index++;
+            }
+        }
+
+        return {
+            .triangles = triangles,
+            .runs = zcl::ArenaPushArrayClone(arena, zcl::ArraySlice(runs_temp, 0, run_cnt)),
+            .size = arrangement.metrics.size,
+        };
+    }
 }
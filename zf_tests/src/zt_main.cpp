@@ -1,75 +1,1626 @@
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+
 #include <zcl.h>
 
-static void TestSorting(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
-    enum t_sort_type {
-        ek_sort_type_bubble,
-        ek_sort_type_insertion,
-        ek_sort_type_selection,
-        ek_sort_type_merge,
-        ek_sort_type_quick,
+static void TestSorting(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    enum t_sort_type {
+        ek_sort_type_bubble,
+        ek_sort_type_insertion,
+        ek_sort_type_selection,
+        ek_sort_type_merge,
+        ek_sort_type_heap,
+        ek_sort_type_quick,
+        ek_sort_type_radix,
+
+        ekm_sort_type_cnt,
+    };
+
+    enum t_sort_input {
+        ek_sort_input_random,
+        ek_sort_input_sorted,
+        ek_sort_input_reversed,
+        ek_sort_input_all_equal,
+
+        ekm_sort_input_cnt,
+    };
+
+    const auto nums_generator = [rng, temp_arena](const zcl::t_i32 len, const t_sort_input input) -> zcl::t_array_mut<zcl::t_i32> {
+        ZCL_ASSERT(len >= 0);
+
+        if (len == 0) {
+            return {};
+        }
+
+        const auto result = zcl::ArenaPushArray<zcl::t_i32>(temp_arena, len);
+
+        for (zcl::t_i32 i = 0; i < result.len; i++) {
+            result[i] = zcl::RandGenI32(rng);
+        }
+
+        switch (input) {
+            case ek_sort_input_random: {
+                break;
+            }
+
+            case ek_sort_input_sorted: {
+                std::sort(result.raw, result.raw + result.len);
+                break;
+            }
+
+            case ek_sort_input_reversed: {
+                std::sort(result.raw, result.raw + result.len);
+                zcl::Reverse(result);
+                break;
+            }
+
+            case ek_sort_input_all_equal: {
+                zcl::SetAllTo(result, result[0]);
+                break;
+            }
+
+            case ekm_sort_input_cnt: {
+                ZCL_UNREACHABLE();
+            }
+        }
+
+        return result;
+    };
+
+    const auto run_sort = [temp_arena](const t_sort_type type, const zcl::t_array_mut<zcl::t_i32> nums) {
+        switch (type) {
+            case ek_sort_type_bubble: {
+                zcl::RunBubbleSort(nums);
+                break;
+            }
+
+            case ek_sort_type_insertion: {
+                zcl::RunInsertionSort(nums);
+                break;
+            }
+
+            case ek_sort_type_selection: {
+                zcl::RunSelectionSort(nums);
+                break;
+            }
+
+            case ek_sort_type_merge: {
+                zcl::RunMergeSort(nums, temp_arena);
+                break;
+            }
+
+            case ek_sort_type_heap: {
+                zcl::RunHeapSort(nums);
+                break;
+            }
+
+            case ek_sort_type_quick: {
+                zcl::RunQuickSort(nums);
+                break;
+            }
+
+            case ek_sort_type_radix: {
+                zcl::RunRadixSort(nums, temp_arena);
+                break;
+            }
+
+            case ekm_sort_type_cnt: {
+                ZCL_UNREACHABLE();
+            }
+        }
+    };
+
+    // Every sort must give exactly what std::sort does.
+    const auto test_sort = [temp_arena, &run_sort](const t_sort_type type, const zcl::t_array_mut<zcl::t_i32> nums) {
+        const auto expected = zcl::ArenaPushArray<zcl::t_i32>(temp_arena, nums.len);
+        zcl::ArrayCopy(nums, expected);
+        std::sort(expected.raw, expected.raw + expected.len);
+
+        run_sort(type, nums);
+
+        ZCL_REQUIRE(zcl::CheckSorted(nums));
+        ZCL_REQUIRE(zcl::CompareAllBin(nums, expected));
+    };
+
+    // Large enough that the O(n log n) sorts get well past their insertion sort cutoffs.
+    constexpr zcl::t_i32 k_large_len = 100000;
+
+    for (zcl::t_i32 i = 0; i < ekm_sort_type_cnt; i++) {
+        const auto type = static_cast<t_sort_type>(i);
+        const zcl::t_b8 quadratic = type == ek_sort_type_bubble || type == ek_sort_type_insertion || type == ek_sort_type_selection;
+
+        for (zcl::t_i32 j = 0; j < ekm_sort_input_cnt; j++) {
+            const auto input = static_cast<t_sort_input>(j);
+
+            for (zcl::t_i32 len = 0; len < 128; len++) {
+                test_sort(type, nums_generator(len, input));
+                zcl::ArenaRewind(temp_arena);
+            }
+
+            if (!quadratic) {
+                test_sort(type, nums_generator(k_large_len, input));
+                zcl::ArenaRewind(temp_arena);
+            }
+        }
+    }
+
+    // Quicksort must fall back to heap sort on input built to make every partition as lopsided as possible, rather than going quadratic.
+    // The input is built by McIlroy's adversary: values start out undecided, and whenever two undecided values are compared one of them is fixed as lower than everything still undecided, favouring the one that looks like the pivot.
+    {
+        const auto vals = zcl::ArenaPushArray<zcl::t_i32>(temp_arena, k_large_len);
+        zcl::SetAllTo(vals, k_large_len); // Undecided values are greater than every decided one.
+
+        zcl::t_i32 decided_cnt = 0;
+        zcl::t_i32 pivot_candidate = 0;
+        zcl::t_i64 comparison_cnt = 0;
+
+        const auto adversary = [vals, &decided_cnt, &pivot_candidate, &comparison_cnt](const zcl::t_i32 &a, const zcl::t_i32 &b) -> zcl::t_i32 {
+            comparison_cnt++;
+
+            if (vals[a] == k_large_len && vals[b] == k_large_len) {
+                vals[a == pivot_candidate ? a : b] = decided_cnt;
+                decided_cnt++;
+            }
+
+            if (vals[a] == k_large_len) {
+                pivot_candidate = a;
+            } else if (vals[b] == k_large_len) {
+                pivot_candidate = b;
+            }
+
+            return vals[a] - vals[b];
+        };
+
+        const auto indexes = zcl::ArenaPushArray<zcl::t_i32>(temp_arena, k_large_len);
+
+        for (zcl::t_i32 i = 0; i < indexes.len; i++) {
+            indexes[i] = i;
+        }
+
+        zcl::RunQuickSort(indexes, adversary);
+
+        for (zcl::t_i32 i = 0; i < indexes.len - 1; i++) {
+            ZCL_REQUIRE(vals[indexes[i]] <= vals[indexes[i + 1]]);
+        }
+
+        // Without the fallback this takes on the order of n^2 / 2 comparisons.
+        zcl::t_i64 log_len = 0;
+
+        for (zcl::t_i32 len = k_large_len; len > 1; len /= 2) {
+            log_len++;
+        }
+
+        ZCL_REQUIRE(comparison_cnt <= 16 * k_large_len * log_len);
+
+        // Sorting the values the adversary settled on takes the same path again.
+        test_sort(ek_sort_type_quick, vals);
+
+        zcl::ArenaRewind(temp_arena);
+    }
+
+    // Merge sorting must be stable.
+    const auto test_merge_sort_stability = [rng, temp_arena](const zcl::t_i32 len) {
+        const auto pairs = zcl::ArenaPushArray<zcl::t_key_index_pair<zcl::t_i16>>(temp_arena, len);
+
+        for (zcl::t_i32 i = 0; i < pairs.len; i++) {
+            pairs[i] = {.key = static_cast<zcl::t_i16>(zcl::RandGenI32InRange(rng, -8, 8)), .index = i};
+        }
+
+        zcl::RunMergeSort(pairs, temp_arena, [](const zcl::t_key_index_pair<zcl::t_i16> &a, const zcl::t_key_index_pair<zcl::t_i16> &b) -> zcl::t_i32 {
+            return a.key - b.key;
+        });
+
+        for (zcl::t_i32 i = 0; i < pairs.len - 1; i++) {
+            ZCL_REQUIRE(pairs[i].key < pairs[i + 1].key || (pairs[i].key == pairs[i + 1].key && pairs[i].index < pairs[i + 1].index));
+        }
+
+        zcl::ArenaRewind(temp_arena);
+    };
+
+    for (zcl::t_i32 len = 0; len < 128; len++) {
+        test_merge_sort_stability(len);
+    }
+
+    test_merge_sort_stability(k_large_len);
+
+    // Radix sorting of floats, including negatives and zeroes of both signs.
+    for (zcl::t_i32 len = 0; len < 128; len++) {
+        const auto nums = zcl::ArenaPushArray<zcl::t_f32>(temp_arena, len);
+
+        for (zcl::t_i32 i = 0; i < nums.len; i++) {
+            nums[i] = zcl::RandGenPerc(rng) < 0.1f ? (zcl::RandGenPerc(rng) < 0.5f ? -0.0f : 0.0f) : zcl::RandGenF32InRange(rng, -1000.0f, 1000.0f);
+        }
+
+        zcl::RunRadixSort(nums, temp_arena);
+
+        ZCL_REQUIRE(zcl::CheckSorted(nums));
+
+        zcl::ArenaRewind(temp_arena);
+    }
+
+    // Radix sorting of key-index pairs must be stable.
+    for (zcl::t_i32 len = 0; len < 128; len++) {
+        const auto pairs = zcl::ArenaPushArray<zcl::t_key_index_pair<zcl::t_i16>>(temp_arena, len);
+
+        for (zcl::t_i32 i = 0; i < pairs.len; i++) {
+            pairs[i] = {.key = static_cast<zcl::t_i16>(zcl::RandGenI32InRange(rng, -8, 8)), .index = i};
+        }
+
+        zcl::RunRadixSort(pairs, temp_arena);
+
+        for (zcl::t_i32 i = 0; i < pairs.len - 1; i++) {
+            ZCL_REQUIRE(pairs[i].key < pairs[i + 1].key || (pairs[i].key == pairs[i + 1].key && pairs[i].index < pairs[i + 1].index));
+        }
+
+        zcl::ArenaRewind(temp_arena);
+    }
+}
+
+static void TestBinarySearch(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    for (zcl::t_i32 len = 0; len < 100; len++) {
+        // Small value range so there are plenty of duplicates and gaps.
+        const auto nums = zcl::ArenaPushArray<zcl::t_i32>(temp_arena, len);
+
+        for (zcl::t_i32 i = 0; i < nums.len; i++) {
+            nums[i] = zcl::RandGenI32InRange(rng, 0, 40);
+        }
+
+        zcl::RunQuickSort(nums);
+
+        const auto layout = zcl::EytzingerLayoutCreate(nums, temp_arena);
+
+        for (zcl::t_i32 val = -1; val <= 41; val++) {
+            zcl::t_i32 expected_lower = 0;
+
+            while (expected_lower < nums.len && nums[expected_lower] < val) {
+                expected_lower++;
+            }
+
+            zcl::t_i32 expected_upper = expected_lower;
+
+            while (expected_upper < nums.len && nums[expected_upper] == val) {
+                expected_upper++;
+            }
+
+            ZCL_REQUIRE(zcl::BinarySearchLowerBound(nums, val) == expected_lower);
+            ZCL_REQUIRE(zcl::BinarySearchUpperBound(nums, val) == expected_upper);
+
+            zcl::t_i32 begin, end;
+            zcl::BinarySearchEqualRange(nums, val, &begin, &end);
+            ZCL_REQUIRE(begin == expected_lower && end == expected_upper);
+
+            ZCL_REQUIRE(zcl::RunBinarySearch(nums, val) == (expected_upper > expected_lower));
+
+            // A reversed comparator must be respected too, with the array in descending order.
+            const auto comparator_rev = [](const zcl::t_i32 &a, const zcl::t_i32 &b) { return b - a; };
+            zcl::Reverse(nums);
+            ZCL_REQUIRE(zcl::BinarySearchLowerBound(nums, val, comparator_rev) == nums.len - expected_upper);
+            ZCL_REQUIRE(zcl::RunBinarySearch(nums, val, comparator_rev) == (expected_upper > expected_lower));
+            zcl::Reverse(nums);
+
+            const zcl::t_i32 layout_index = zcl::EytzingerSearchLowerBound(layout, val);
+
+            if (expected_lower == nums.len) {
+                ZCL_REQUIRE(layout_index == -1);
+            } else {
+                ZCL_REQUIRE(layout_index != -1 && layout[layout_index] == nums[expected_lower]);
+            }
+
+            ZCL_REQUIRE((zcl::EytzingerSearch(layout, val) != -1) == (expected_upper > expected_lower));
+        }
+
+        zcl::ArenaRewind(temp_arena);
+    }
+}
+
+static void TestUTF8(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    // A plain byte-by-byte validator to compare against.
+    const auto check_valid_reference = [](const zcl::t_str_rdonly str) {
+        zcl::t_i32 i = 0;
+
+        while (i < str.bytes.len) {
+            const zcl::t_u8 byte = str.bytes[i];
+            const zcl::t_i32 byte_cnt = byte < 0x80 ? 1 : byte < 0xC0 ? 0 : byte < 0xE0 ? 2 : byte < 0xF0 ? 3 : byte < 0xF8 ? 4 : 0;
+
+            if (byte_cnt == 0 || i + byte_cnt > str.bytes.len) {
+                return false;
+            }
+
+            for (zcl::t_i32 j = 1; j < byte_cnt; j++) {
+                if ((str.bytes[i + j] & 0xC0) != 0x80) {
+                    return false;
+                }
+            }
+
+            i += byte_cnt;
+        }
+
+        return true;
+    };
+
+    for (zcl::t_i32 iter = 0; iter < 2000; iter++) {
+        const zcl::t_i32 code_pt_cnt = zcl::RandGenI32InRange(rng, 0, 100);
+
+        // Mostly ASCII, with runs of other code points mixed in, so that both whole-ASCII and mixed blocks come up.
+        auto bytes = zcl::ListCreate<zcl::t_u8>(code_pt_cnt * 4 + 1, temp_arena);
+
+        for (zcl::t_i32 i = 0; i < code_pt_cnt; i++) {
+            const zcl::t_code_point code_pt = zcl::RandGenI32InRange(rng, 0, 4) == 0 ? zcl::RandGenU32InRange(rng, 0x80, zcl::k_code_point_count) : zcl::RandGenU32InRange(rng, 0, 0x80);
+
+            zcl::t_static_array<zcl::t_u8, 4> code_pt_bytes;
+            zcl::t_i32 code_pt_byte_cnt;
+            zcl::CodePointToUTF8Bytes(code_pt, &code_pt_bytes, &code_pt_byte_cnt);
+
+            zcl::ListAppendMany(&bytes, zcl::ArraySlice(zcl::ArrayToNonstatic(&code_pt_bytes), 0, code_pt_byte_cnt));
+        }
+
+        const zcl::t_str_rdonly str = {zcl::ListToArray(&bytes)};
+
+        ZCL_REQUIRE(zcl::StrCheckValidUTF8(str));
+        ZCL_REQUIRE(zcl::StrCalcLen(str) == code_pt_cnt);
+
+        if (bytes.len == 0) {
+            continue;
+        }
+
+        // Now corrupt a byte or cut the string short, and see that the verdict matches the reference.
+        if (zcl::RandGenI32InRange(rng, 0, 2) == 0) {
+            bytes[zcl::RandGenI32InRange(rng, 0, static_cast<zcl::t_i16>(bytes.len))] = static_cast<zcl::t_u8>(zcl::RandGenU32InRange(rng, 0, 256));
+        } else {
+            bytes.len = zcl::RandGenI32InRange(rng, 0, static_cast<zcl::t_i16>(bytes.len));
+        }
+
+        const zcl::t_str_rdonly str_corrupted = {zcl::ListToArray(&bytes)};
+        ZCL_REQUIRE(zcl::StrCheckValidUTF8(str_corrupted) == check_valid_reference(str_corrupted));
+    }
+}
+
+static void TestStrInterner(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    // Short strings over a tiny alphabet, so that plenty come up more than once.
+    constexpr zcl::t_i32 k_str_cnt = 500;
+
+    const auto strs = zcl::ArenaPushArray<zcl::t_str_rdonly>(temp_arena, k_str_cnt);
+
+    for (zcl::t_i32 i = 0; i < k_str_cnt; i++) {
+        const auto bytes = zcl::ArenaPushArray<zcl::t_u8>(temp_arena, zcl::RandGenI32InRange(rng, 1, 5));
+
+        for (zcl::t_i32 j = 0; j < bytes.len; j++) {
+            bytes[j] = static_cast<zcl::t_u8>('a' + zcl::RandGenI32InRange(rng, 0, 3));
+        }
+
+        strs[i] = {bytes};
+    }
+
+    strs[0] = {};
+
+    zcl::t_str_interner *const interner = zcl::StrInternerCreate(temp_arena, 1);
+
+    const auto ids = zcl::ArenaPushArray<zcl::t_str_id>(temp_arena, k_str_cnt);
+    zcl::t_i32 unique_cnt = 0;
+
+    for (zcl::t_i32 i = 0; i < k_str_cnt; i++) {
+        zcl::t_b8 seen = false;
+
+        for (zcl::t_i32 j = 0; j < i; j++) {
+            if (zcl::StrsCheckEqual(strs[i], strs[j])) {
+                seen = true;
+                break;
+            }
+        }
+
+        zcl::t_str_id found_id;
+        ZCL_REQUIRE(zcl::StrInternerFind(interner, strs[i], &found_id) == seen);
+
+        ids[i] = zcl::StrIntern(interner, strs[i]);
+
+        if (!seen) {
+            ZCL_REQUIRE(ids[i].index == unique_cnt);
+            unique_cnt++;
+        } else {
+            ZCL_REQUIRE(zcl::StrIDsCheckEqual(found_id, ids[i]));
+        }
+
+        ZCL_REQUIRE(zcl::StrsCheckEqual(zcl::StrInternerGetStr(interner, ids[i]), strs[i]));
+    }
+
+    ZCL_REQUIRE(zcl::StrInternerGetCount(interner) == unique_cnt);
+
+    for (zcl::t_i32 i = 0; i < k_str_cnt; i++) {
+        for (zcl::t_i32 j = 0; j < k_str_cnt; j++) {
+            ZCL_REQUIRE(zcl::StrIDsCheckEqual(ids[i], ids[j]) == zcl::StrsCheckEqual(strs[i], strs[j]));
+        }
+    }
+}
+
+static void TestStrBuilder(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    zcl::t_arena *const arena = zcl::ArenaCreateBlockBased();
+    ZCL_DEFER({ zcl::ArenaDestroy(arena); });
+
+    auto builder = zcl::StrBuilderCreate(arena, 1);
+    const zcl::t_u8 *const backing_raw = builder.stream.bytes.backing_arr.raw;
+
+    // The expected bytes are put together separately, one at a time.
+    auto expected = zcl::ListCreate<zcl::t_u8>(1, temp_arena);
+
+    const auto expect_str = [&expected, temp_arena](const zcl::t_str_rdonly str) {
+        for (zcl::t_i32 i = 0; i < str.bytes.len; i++) {
+            zcl::ListAppendDynamic(&expected, str.bytes[i], temp_arena);
+        }
+    };
+
+    const zcl::t_static_array<zcl::t_str_rdonly, 3> pieces = {{
+        ZCL_STR_LITERAL("abc"),
+        ZCL_STR_LITERAL(""),
+        ZCL_STR_LITERAL("Hello, world!"),
+    }};
+
+    for (zcl::t_i32 i = 0; i < 1000; i++) {
+        switch (zcl::RandGenI32InRange(rng, 0, 3)) {
+            case 0: {
+                const zcl::t_str_rdonly piece = pieces[zcl::RandGenI32InRange(rng, 0, static_cast<zcl::t_i16>(pieces.k_len))];
+                zcl::StrBuilderAppend(&builder, piece);
+                expect_str(piece);
+                break;
+            }
+
+            case 1: {
+                const zcl::t_code_point code_pt = zcl::RandGenU32InRange(rng, 0, zcl::k_code_point_count);
+                zcl::StrBuilderAppendCodePoint(&builder, code_pt);
+
+                zcl::t_static_array<zcl::t_u8, 4> code_pt_bytes;
+                zcl::t_i32 code_pt_byte_cnt;
+                zcl::CodePointToUTF8Bytes(code_pt, &code_pt_bytes, &code_pt_byte_cnt);
+                expect_str({zcl::ArraySlice(zcl::ArrayToNonstatic(&code_pt_bytes), 0, code_pt_byte_cnt)});
+
+                break;
+            }
+
+            case 2: {
+                zcl::StrBuilderAppendFormat(&builder, "[%]", -42);
+                expect_str(ZCL_STR_LITERAL("[-42]"));
+                break;
+            }
+        }
+    }
+
+    // Nothing else was pushed to the arena, so all growth should have happened in place.
+    ZCL_REQUIRE(builder.stream.bytes.backing_arr.raw == backing_raw);
+
+    const zcl::t_str_mut str = zcl::StrBuilderGetStrTerminated(&builder);
+    ZCL_REQUIRE(zcl::StrsCheckEqual({zcl::ArraySlice(str.bytes, 0, str.bytes.len - 1)}, {zcl::ListToArray(&expected)}));
+    ZCL_REQUIRE(zcl::StrBytesCheckTerminatedOnlyAtEnd(str.bytes));
+    ZCL_REQUIRE(zcl::StrBuilderGetLen(&builder) == expected.len);
+    ZCL_REQUIRE(zcl::StrCheckValidUTF8(str));
+
+    zcl::StrBuilderClear(&builder);
+    ZCL_REQUIRE(zcl::StrBuilderGetLen(&builder) == 0);
+}
+
+static void TestPrintFormat(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    const auto check = [temp_arena](const zcl::t_str_rdonly expected, const auto &print_func) {
+        // Into a byte stream with plenty of room, so that formatters can write into it directly.
+        {
+            const auto bytes = zcl::ArenaPushArray<zcl::t_u8>(temp_arena, 256);
+            zcl::t_byte_stream stream = zcl::ByteStreamCreate(bytes, zcl::ek_stream_mode_write);
+
+            ZCL_REQUIRE(print_func(zcl::ByteStreamGetView(&stream)));
+            ZCL_REQUIRE(zcl::StrsCheckEqual({zcl::ByteStreamGetWritten(&stream)}, expected));
+        }
+
+        // Into a byte stream with exactly enough room, so that reservations fail and formatters fall back to regular writes.
+        {
+            const auto bytes = zcl::ArenaPushArray<zcl::t_u8>(temp_arena, zcl::CalcMax(expected.bytes.len, 1));
+            zcl::t_byte_stream stream = zcl::ByteStreamCreate(bytes, zcl::ek_stream_mode_write);
+
+            ZCL_REQUIRE(print_func(zcl::ByteStreamGetView(&stream)));
+            ZCL_REQUIRE(zcl::StrsCheckEqual({zcl::ByteStreamGetWritten(&stream)}, expected));
+        }
+
+        // Into a string builder, which grows to fit any reservation.
+        {
+            auto builder = zcl::StrBuilderCreate(temp_arena, 1);
+
+            ZCL_REQUIRE(print_func(zcl::StrBuilderGetView(&builder)));
+            ZCL_REQUIRE(zcl::StrsCheckEqual(zcl::StrBuilderGetStr(&builder), expected));
+        }
+    };
+
+    check(ZCL_STR_LITERAL("plain text"), [](const zcl::t_stream_view sv) { return zcl::PrintFormat(sv, "plain text"); });
+    check(ZCL_STR_LITERAL("100% ^ done"), [](const zcl::t_stream_view sv) { return zcl::PrintFormat(sv, "100^% ^^ done"); });
+    check(ZCL_STR_LITERAL("%7^ [8]"), [](const zcl::t_stream_view sv) { return zcl::PrintFormat(sv, "^%%^^ [%]", 7, 8); });
+    check(ZCL_STR_LITERAL("a=1, b=-23, c=x%"), [](const zcl::t_stream_view sv) { return zcl::PrintFormat(sv, "a=%, b=%, c=%^%", 1, -23, ZCL_STR_LITERAL("x")); });
+    check(ZCL_STR_LITERAL("0"), [](const zcl::t_stream_view sv) { return zcl::PrintFormat(sv, "%", 0); });
+    check(ZCL_STR_LITERAL("9223372036854775807 -9223372036854775808 18446744073709551615"), [](const zcl::t_stream_view sv) { return zcl::PrintFormat(sv, "% % %", zcl::k_i64_max, zcl::k_i64_min, zcl::k_u64_max); });
+    check(ZCL_STR_LITERAL("-128 255"), [](const zcl::t_stream_view sv) { return zcl::PrintFormat(sv, "% %", static_cast<zcl::t_i8>(-128), static_cast<zcl::t_u8>(255)); });
+    check(ZCL_STR_LITERAL("0.1 -2.5 100 0"), [](const zcl::t_stream_view sv) { return zcl::PrintFormat(sv, "% % % %", 0.1f, -2.5, 100.0f, 0.0f); });
+    check(ZCL_STR_LITERAL("3.14 3.142 1.5"), [](const zcl::t_stream_view sv) { return zcl::PrintFormat(sv, "% % %", zcl::FormatFloat(3.14159f, 2), zcl::FormatFloat(3.14159, 3), zcl::FormatFloat(1.5f, 4, true)); });
+    check(ZCL_STR_LITERAL("1000000015047466219876688855040"), [](const zcl::t_stream_view sv) { return zcl::PrintFormat(sv, "%", 1e30f); });
+
+    for (zcl::t_i32 i = 0; i < 100; i++) {
+        const zcl::t_i32 value = zcl::RandGenI32(rng);
+
+        char expected_c_str[32];
+        snprintf(expected_c_str, sizeof(expected_c_str), "[%d]", value);
+
+        check(zcl::CStrToStr(static_cast<const char *>(expected_c_str)), [value](const zcl::t_stream_view sv) { return zcl::PrintFormat(sv, "[%]", value); });
+    }
+
+    // Shortest floats have to read back as exactly the same value.
+    for (zcl::t_i32 i = 0; i < 1000; i++) {
+        zcl::t_f32 value;
+
+        do {
+            const zcl::t_u32 bits = zcl::RandGenU32(rng);
+            memcpy(&value, &bits, sizeof(value));
+        } while (zcl::CheckNaN(value) || value - value != 0.0f);
+
+        auto builder = zcl::StrBuilderCreate(temp_arena);
+        zcl::StrBuilderAppendFormat(&builder, "%\0", value);
+
+        ZCL_REQUIRE(strtof(zcl::StrToCStr(zcl::StrBuilderGetStr(&builder)), nullptr) == value);
+    }
+}
+
+static void TestStreams(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    const auto src_bytes = zcl::ArenaPushArray<zcl::t_u8>(temp_arena, 10000);
+
+    for (zcl::t_i32 i = 0; i < src_bytes.len; i++) {
+        src_bytes[i] = static_cast<zcl::t_u8>(zcl::RandGenU32InRange(rng, 0, 256));
+    }
+
+    // Writes the source bytes in randomly sized pieces, some through reservations where the stream supports them.
+    const auto write_in_pieces = [rng, src_bytes](const zcl::t_stream_view sv) {
+        zcl::t_i32 pos = 0;
+
+        while (pos < src_bytes.len) {
+            const zcl::t_i32 piece_len = zcl::CalcMin(zcl::RandGenI32InRange(rng, 1, 600), src_bytes.len - pos);
+            const auto piece = zcl::ArraySlice(src_bytes, pos, pos + piece_len);
+
+            const zcl::t_array_mut<zcl::t_u8> reserved = zcl::RandGenPerc(rng) < 0.5f ? zcl::StreamReserve(sv, piece_len) : zcl::t_array_mut<zcl::t_u8>{};
+
+            if (reserved.len > 0) {
+                zcl::ArrayCopy(piece, reserved);
+                zcl::StreamCommit(sv, piece_len);
+            } else {
+                ZCL_REQUIRE(zcl::StreamWriteItemsOfArray(sv, piece));
+            }
+
+            pos += piece_len;
+        }
+    };
+
+    // Memory stream, starting small enough that it has to grow many times.
+    {
+        auto stream = zcl::MemStreamCreate(temp_arena, 1);
+        write_in_pieces(zcl::MemStreamGetView(&stream));
+
+        const auto written = zcl::MemStreamGetWritten(&stream);
+        ZCL_REQUIRE(written.len == src_bytes.len);
+
+        for (zcl::t_i32 i = 0; i < written.len; i++) {
+            ZCL_REQUIRE(written[i] == src_bytes[i]);
+        }
+
+        zcl::MemStreamClear(&stream);
+        ZCL_REQUIRE(zcl::MemStreamGetWritten(&stream).len == 0);
+    }
+
+    // File stream with a write buffer smaller than some of the pieces, so that both the buffered and direct paths get hit.
+    {
+        FILE *const file_raw = tmpfile();
+        ZCL_REQUIRE(file_raw);
+
+        zcl::t_file_stream write_stream = zcl::FileStreamCreateOpen(file_raw, zcl::ek_stream_mode_write);
+        zcl::FileStreamSetWriteBuffer(&write_stream, zcl::ArenaPushArray<zcl::t_u8>(temp_arena, 256));
+
+        write_in_pieces(zcl::FileStreamGetView(&write_stream));
+
+        ZCL_REQUIRE(zcl::FileStreamFlushWriteBuffer(&write_stream));
+        ZCL_REQUIRE(zcl::FileCalcSize(&write_stream) == src_bytes.len);
+
+        rewind(file_raw);
+
+        zcl::t_file_stream read_stream = zcl::FileStreamCreateOpen(file_raw, zcl::ek_stream_mode_read);
+
+        const auto read_bytes = zcl::ArenaPushArray<zcl::t_u8>(temp_arena, src_bytes.len);
+        ZCL_REQUIRE(zcl::StreamReadItemsIntoArray(zcl::FileStreamGetView(&read_stream), read_bytes, read_bytes.len));
+
+        for (zcl::t_i32 i = 0; i < read_bytes.len; i++) {
+            ZCL_REQUIRE(read_bytes[i] == src_bytes[i]);
+        }
+
+        zcl::FileClose(&read_stream);
+    }
+}
+
+static void TestFileMap(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    const auto path = ZCL_STR_LITERAL("zt_file_map_test.bin");
+    ZCL_DEFER({ remove("zt_file_map_test.bin"); });
+
+    const auto src_bytes = zcl::ArenaPushArray<zcl::t_u8>(temp_arena, zcl::RandGenI32InRange(rng, 1, 20000));
+
+    for (zcl::t_i32 i = 0; i < src_bytes.len; i++) {
+        src_bytes[i] = static_cast<zcl::t_u8>(zcl::RandGenU32InRange(rng, 0, 256));
+    }
+
+    {
+        zcl::t_file_stream stream;
+        ZCL_REQUIRE(zcl::FileOpen(path, zcl::ek_file_access_mode_write, temp_arena, &stream));
+        ZCL_REQUIRE(zcl::StreamWriteItemsOfArray(zcl::FileStreamGetView(&stream), src_bytes));
+        zcl::FileClose(&stream);
+    }
+
+    zcl::t_mapped_file mapped_file;
+    ZCL_REQUIRE(zcl::FileMap(path, temp_arena, &mapped_file));
+    ZCL_REQUIRE(mapped_file.contents.len == src_bytes.len);
+
+    for (zcl::t_i32 i = 0; i < src_bytes.len; i++) {
+        ZCL_REQUIRE(mapped_file.contents[i] == src_bytes[i]);
+    }
+
+    zcl::FileUnmap(&mapped_file);
+
+    // An empty file maps to empty contents.
+    ZCL_REQUIRE(zcl::FileCreate(path, temp_arena));
+    ZCL_REQUIRE(zcl::FileMap(path, temp_arena, &mapped_file));
+    ZCL_REQUIRE(mapped_file.contents.len == 0);
+    zcl::FileUnmap(&mapped_file);
+}
+
+static void TestFileLoader(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    constexpr zcl::t_i32 k_file_cnt = 24;
+
+    struct t_file {
+        zcl::t_str_mut path;
+        zcl::t_array_mut<zcl::t_u8> bytes;
+        zcl::t_arena *contents_arena;
+        zcl::t_b8 loaded;
+    };
+
+    const auto files = zcl::ArenaPushArray<t_file>(temp_arena, k_file_cnt);
+
+    for (zcl::t_i32 i = 0; i < k_file_cnt; i++) {
+        t_file *const file = &files[i];
+
+        zcl::t_str_builder path_builder = zcl::StrBuilderCreate(temp_arena);
+        zcl::StrBuilderAppendFormat(&path_builder, "zt_file_loader_test_%.bin", i);
+        file->path = zcl::StrBuilderGetStr(&path_builder);
+
+        file->bytes = zcl::ArenaPushArray<zcl::t_u8>(temp_arena, zcl::RandGenI32InRange(rng, 0, 20000));
+
+        for (zcl::t_i32 j = 0; j < file->bytes.len; j++) {
+            file->bytes[j] = static_cast<zcl::t_u8>(zcl::RandGenU32InRange(rng, 0, 256));
+        }
+
+        zcl::t_file_stream stream;
+        ZCL_REQUIRE(zcl::FileOpen(file->path, zcl::ek_file_access_mode_write, temp_arena, &stream));
+        ZCL_REQUIRE(zcl::StreamWriteItemsOfArray(zcl::FileStreamGetView(&stream), file->bytes));
+        zcl::FileClose(&stream);
+
+        file->contents_arena = zcl::ArenaCreateBlockBased();
+    }
+
+    ZCL_DEFER({
+        for (zcl::t_i32 i = 0; i < k_file_cnt; i++) {
+            zcl::ArenaDestroy(files[i].contents_arena);
+            remove(zcl::StrToCStr(zcl::StrCloneButAddTerminator(files[i].path, temp_arena)));
+        }
+    });
+
+    // Fewer request slots than files, so submission has to back off until polling frees some up.
+    zcl::t_file_loader *const loader = zcl::FileLoaderCreate(3, 8, temp_arena);
+
+    zcl::t_arena *const missing_contents_arena = zcl::ArenaCreateBlockBased();
+    ZCL_DEFER({ zcl::ArenaDestroy(missing_contents_arena); });
+
+    const zcl::t_file_load_request missing_request = {
+        .path = ZCL_STR_LITERAL("zt_file_loader_test_missing.bin"),
+        .contents_arena = missing_contents_arena,
+    };
+
+    ZCL_REQUIRE(zcl::FileLoaderSubmit(loader, missing_request));
+
+    zcl::t_i32 submit_index = 0;
+
+    while (submit_index < k_file_cnt || zcl::FileLoaderGetOutstandingCount(loader) > 0) {
+        while (submit_index < k_file_cnt) {
+            const zcl::t_file_load_request request = {
+                .path = files[submit_index].path,
+                .contents_arena = files[submit_index].contents_arena,
+                .user_data = &files[submit_index],
+            };
+
+            if (!zcl::FileLoaderSubmit(loader, request)) {
+                break;
+            }
+
+            submit_index++;
+        }
+
+        zcl::t_file_load_completion completion;
+
+        while (zcl::FileLoaderPoll(loader, &completion)) {
+            if (!completion.user_data) {
+                ZCL_REQUIRE(!completion.success && completion.contents.len == 0);
+                continue;
+            }
+
+            t_file *const file = static_cast<t_file *>(completion.user_data);
+
+            ZCL_REQUIRE(completion.success && !file->loaded);
+            ZCL_REQUIRE(completion.contents.len == file->bytes.len);
+
+            for (zcl::t_i32 j = 0; j < file->bytes.len; j++) {
+                ZCL_REQUIRE(completion.contents[j] == file->bytes[j]);
+            }
+
+            file->loaded = true;
+        }
+    }
+
+    for (zcl::t_i32 i = 0; i < k_file_cnt; i++) {
+        ZCL_REQUIRE(files[i].loaded);
+    }
+
+    zcl::FileLoaderDestroy(loader);
+}
+
+// Gives the byte index of the first occurrence of the substring, or -1 if there is none.
+static zcl::t_i32 FindSubstr(const zcl::t_str_rdonly str, const zcl::t_str_rdonly substr) {
+    for (zcl::t_i32 i = 0; i + substr.bytes.len <= str.bytes.len; i++) {
+        if (zcl::StrsCheckEqual({zcl::ArraySlice(str.bytes, i, i + substr.bytes.len)}, substr)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+// Parses the decimal number starting at the given byte index.
+static zcl::t_i32 ParseDecNum(const zcl::t_str_rdonly str, zcl::t_i32 byte_index) {
+    zcl::t_i32 result = 0;
+
+    for (; byte_index < str.bytes.len && str.bytes[byte_index] >= '0' && str.bytes[byte_index] <= '9'; byte_index++) {
+        result = (result * 10) + (str.bytes[byte_index] - '0');
+    }
+
+    return result;
+}
+
+static void TestLogger(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    const auto path = ZCL_STR_LITERAL("zt_logger_test.log");
+
+    const auto remove_files = []() {
+        remove("zt_logger_test.log");
+        remove("zt_logger_test.log.1");
+        remove("zt_logger_test.log.2");
+        remove("zt_logger_test.log.3");
+    };
+
+    remove_files();
+    ZCL_DEFER({ remove_files(); });
+
+    // Splits on bytes rather than with StrSplitLines, since the logs can be large and that validates the UTF-8 on every step when assertions are on.
+    const auto load_lines = [temp_arena](const zcl::t_str_rdonly file_path) {
+        zcl::t_array_mut<zcl::t_u8> contents;
+        ZCL_REQUIRE(zcl::FileLoadContents(file_path, temp_arena, temp_arena, &contents));
+
+        zcl::t_i32 line_cnt = 1;
+
+        for (zcl::t_i32 i = 0; i < contents.len; i++) {
+            if (contents[i] == '\n') {
+                line_cnt++;
+            }
+        }
+
+        const auto lines = zcl::ArenaPushArray<zcl::t_str_rdonly>(temp_arena, line_cnt);
+
+        zcl::t_i32 line_index = 0;
+        zcl::t_i32 line_begin = 0;
+
+        for (zcl::t_i32 i = 0; i <= contents.len; i++) {
+            if (i == contents.len || contents[i] == '\n') {
+                lines[line_index] = {zcl::ArraySlice(contents, line_begin, i)};
+                line_index++;
+                line_begin = i + 1;
+            }
+        }
+
+        return lines;
+    };
+
+    // Loggers get their own arenas, since rings are allocated from them on whichever thread first logs.
+    const auto create_logger = [](const zcl::t_logger_config &config, zcl::t_arena **const o_arena) {
+        *o_arena = zcl::ArenaCreateBlockBased();
+
+        zcl::t_logger *logger;
+        ZCL_REQUIRE(zcl::LoggerCreate(config, *o_arena, &logger));
+
+        return logger;
+    };
+
+    // Several threads at once. Each task's records have to come out in the order it wrote them.
+    {
+        constexpr zcl::t_i32 k_thread_cnt = 4;
+        constexpr zcl::t_i32 k_record_cnt = 2000; // Per thread.
+
+        zcl::t_logger_config config = zcl::LoggerConfigCreate();
+        config.console = false;
+        config.file_path = path;
+        config.file_size_limit = 0;
+        config.thread_ring_cap = 8192; // Enough that nothing gets dropped, even if one thread ends up running every task.
+
+        zcl::t_arena *logger_arena;
+        zcl::t_logger *const logger = create_logger(config, &logger_arena);
+
+        zcl::t_worker_pool *const pool = zcl::WorkerPoolCreate(k_thread_cnt - 1, temp_arena);
+
+        zcl::WorkerPoolRun(pool, k_thread_cnt, [logger](const zcl::t_i32 task_index) {
+            for (zcl::t_i32 i = 0; i < k_record_cnt; i++) {
+                zcl::LoggerWrite(logger, zcl::ek_log_level_info, zcl::k_log_category_default, "worker % record %", task_index, i);
+            }
+        });
+
+        zcl::WorkerPoolDestroy(pool);
+
+        zcl::LoggerFlush(logger);
+
+        const auto lines = load_lines(path);
+
+        zcl::t_static_array<zcl::t_i32, k_thread_cnt> next_records = {};
+
+        for (zcl::t_i32 i = 0; i < lines.len; i++) {
+            const zcl::t_i32 worker_index = FindSubstr(lines[i], ZCL_STR_LITERAL("worker "));
+
+            if (worker_index == -1) {
+                continue;
+            }
+
+            const zcl::t_i32 worker = ParseDecNum(lines[i], worker_index + 7);
+            const zcl::t_i32 record = ParseDecNum(lines[i], FindSubstr(lines[i], ZCL_STR_LITERAL(" record ")) + 8);
+
+            ZCL_REQUIRE(worker >= 0 && worker < k_thread_cnt);
+            ZCL_REQUIRE(record == next_records[worker]);
+
+            next_records[worker]++;
+        }
+
+        for (zcl::t_i32 i = 0; i < k_thread_cnt; i++) {
+            ZCL_REQUIRE(next_records[i] == k_record_cnt);
+        }
+
+        zcl::LoggerDestroy(logger);
+        zcl::ArenaDestroy(logger_arena);
+    }
+
+    // Level and category filtering.
+    {
+        const zcl::t_static_array<zcl::t_str_rdonly, 2> category_names = {{ZCL_STR_LITERAL("General"), ZCL_STR_LITERAL("Audio")}};
+
+        zcl::t_logger_config config = zcl::LoggerConfigCreate();
+        config.console = false;
+        config.file_path = path;
+        config.category_names = zcl::ArrayToNonstatic(&category_names);
+        config.level_min = zcl::ek_log_level_warning;
+
+        zcl::t_arena *logger_arena;
+        zcl::t_logger *const logger = create_logger(config, &logger_arena);
+
+        zcl::LoggerSetCategoryEnabled(logger, 1, false);
+
+        ZCL_REQUIRE(!zcl::LoggerCheckEnabled(logger, zcl::ek_log_level_info, 0));
+        ZCL_REQUIRE(zcl::LoggerCheckEnabled(logger, zcl::ek_log_level_warning, 0));
+        ZCL_REQUIRE(!zcl::LoggerCheckEnabled(logger, zcl::ek_log_level_error, 1));
+
+        zcl::LoggerWrite(logger, zcl::ek_log_level_info, 0, "skip 0");
+        zcl::LoggerWrite(logger, zcl::ek_log_level_warning, 0, "keep 0");
+        zcl::LoggerWrite(logger, zcl::ek_log_level_error, 1, "skip 1");
+
+        zcl::LoggerSetCategoryEnabled(logger, 1, true);
+        zcl::LoggerSetLevelMin(logger, zcl::ek_log_level_debug);
+
+        zcl::LoggerWrite(logger, zcl::ek_log_level_debug, 1, "keep 1");
+
+        zcl::LoggerFlush(logger);
+
+        const auto lines = load_lines(path);
+
+        zcl::t_i32 keep_cnt = 0;
+
+        for (zcl::t_i32 i = 0; i < lines.len; i++) {
+            ZCL_REQUIRE(FindSubstr(lines[i], ZCL_STR_LITERAL("skip")) == -1);
+
+            if (FindSubstr(lines[i], ZCL_STR_LITERAL("keep 0")) != -1) {
+                ZCL_REQUIRE(FindSubstr(lines[i], ZCL_STR_LITERAL("[WARNING]")) != -1 && FindSubstr(lines[i], ZCL_STR_LITERAL("[General]")) != -1);
+                keep_cnt++;
+            } else if (FindSubstr(lines[i], ZCL_STR_LITERAL("keep 1")) != -1) {
+                ZCL_REQUIRE(FindSubstr(lines[i], ZCL_STR_LITERAL("[DEBUG]")) != -1 && FindSubstr(lines[i], ZCL_STR_LITERAL("[Audio]")) != -1);
+                keep_cnt++;
+            }
+        }
+
+        ZCL_REQUIRE(keep_cnt == 2);
+
+        zcl::LoggerDestroy(logger);
+        zcl::ArenaDestroy(logger_arena);
+    }
 
-        ekm_sort_type_cnt,
+    // Rotation. Only the newest files are kept, and between them they hold an unbroken run of the latest records.
+    {
+        constexpr zcl::t_i32 k_record_cnt = 300;
+
+        zcl::t_logger_config config = zcl::LoggerConfigCreate();
+        config.console = false;
+        config.file_path = path;
+        config.file_size_limit = 2000;
+        config.file_rotation_cnt = 2;
+
+        zcl::t_arena *logger_arena;
+        zcl::t_logger *const logger = create_logger(config, &logger_arena);
+
+        for (zcl::t_i32 i = 0; i < k_record_cnt; i++) {
+            zcl::LoggerWrite(logger, zcl::ek_log_level_info, 0, "rotation record %", i);
+
+            // Keeps the rings from filling up.
+            if (i % 64 == 63) {
+                zcl::LoggerFlush(logger);
+            }
+        }
+
+        zcl::LoggerDestroy(logger);
+        zcl::ArenaDestroy(logger_arena);
+
+        FILE *const file_oldest_excess = fopen("zt_logger_test.log.3", "rb");
+        ZCL_REQUIRE(!file_oldest_excess);
+
+        const zcl::t_static_array<zcl::t_str_rdonly, 3> paths_oldest_first = {{ZCL_STR_LITERAL("zt_logger_test.log.2"), ZCL_STR_LITERAL("zt_logger_test.log.1"), path}};
+
+        zcl::t_i32 record_next = -1;
+
+        for (zcl::t_i32 i = 0; i < paths_oldest_first.k_len; i++) {
+            const auto lines = load_lines(paths_oldest_first[i]);
+
+            zcl::t_i32 file_size = 0;
+
+            for (zcl::t_i32 j = 0; j < lines.len; j++) {
+                file_size += lines[j].bytes.len + 1;
+
+                const zcl::t_i32 record_index = FindSubstr(lines[j], ZCL_STR_LITERAL("rotation record "));
+
+                if (record_index == -1) {
+                    continue;
+                }
+
+                const zcl::t_i32 record = ParseDecNum(lines[j], record_index + 16);
+                ZCL_REQUIRE(record_next == -1 || record == record_next);
+                record_next = record + 1;
+            }
+
+            ZCL_REQUIRE(file_size - 1 <= config.file_size_limit); // The split gives an empty last line after the final newline.
+        }
+
+        ZCL_REQUIRE(record_next == k_record_cnt);
+    }
+
+    // A ring far too small to keep up. Whatever gets dropped has to be reported, and account for every record missing.
+    {
+        constexpr zcl::t_i32 k_record_cnt = 20000;
+
+        zcl::t_logger_config config = zcl::LoggerConfigCreate();
+        config.console = false;
+        config.file_path = path;
+        config.file_size_limit = 0;
+        config.thread_ring_cap = 4;
+
+        zcl::t_arena *logger_arena;
+        zcl::t_logger *const logger = create_logger(config, &logger_arena);
+
+        for (zcl::t_i32 i = 0; i < k_record_cnt; i++) {
+            zcl::LoggerWrite(logger, zcl::ek_log_level_info, 0, "drop record %", i);
+        }
+
+        zcl::LoggerDestroy(logger);
+        zcl::ArenaDestroy(logger_arena);
+
+        const auto lines = load_lines(path);
+
+        zcl::t_i32 written_cnt = 0;
+        zcl::t_i32 dropped_cnt = 0;
+
+        for (zcl::t_i32 i = 0; i < lines.len; i++) {
+            if (FindSubstr(lines[i], ZCL_STR_LITERAL("drop record ")) != -1) {
+                written_cnt++;
+                continue;
+            }
+
+            const zcl::t_i32 report_index = FindSubstr(lines[i], ZCL_STR_LITERAL(" log records were dropped"));
+
+            if (report_index != -1) {
+                zcl::t_i32 num_begin = report_index;
+
+                while (num_begin > 0 && lines[i].bytes[num_begin - 1] >= '0' && lines[i].bytes[num_begin - 1] <= '9') {
+                    num_begin--;
+                }
+
+                dropped_cnt += ParseDecNum(lines[i], num_begin);
+            }
+        }
+
+        ZCL_REQUIRE(dropped_cnt > 0);
+        ZCL_REQUIRE(written_cnt + dropped_cnt == k_record_cnt);
+    }
+}
+
+static void TestList(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    // Operations are mirrored onto a plain array which is updated the slow way, and the two are compared after each.
+    {
+        constexpr zcl::t_i32 k_op_cnt = 1000;
+
+        auto list = zcl::ListCreate<zcl::t_i32>(1, temp_arena);
+        const auto expected = zcl::ArenaPushArray<zcl::t_i32>(temp_arena, k_op_cnt * 4);
+        zcl::t_i32 expected_len = 0;
+
+        for (zcl::t_i32 op_index = 0; op_index < k_op_cnt; op_index++) {
+            const zcl::t_i32 op_type = zcl::RandGenI32InRange(rng, 0, 4);
+
+            if (op_type == 0) {
+                const zcl::t_i32 value = zcl::RandGenI32InRange(rng, -1000, 1000);
+
+                zcl::ListAppendDynamic(&list, value, temp_arena);
+
+                expected[expected_len] = value;
+                expected_len++;
+            } else if (op_type == 1) {
+                const zcl::t_i32 index = zcl::RandGenI32InRange(rng, 0, expected_len + 1);
+                const zcl::t_i32 value = zcl::RandGenI32InRange(rng, -1000, 1000);
+
+                zcl::ListInsertAtDynamic(&list, index, value, temp_arena);
+
+                for (zcl::t_i32 i = expected_len; i > index; i--) {
+                    expected[i] = expected[i - 1];
+                }
+
+                expected[index] = value;
+                expected_len++;
+            } else if (op_type == 2) {
+                const zcl::t_i32 index = zcl::RandGenI32InRange(rng, 0, expected_len + 1);
+
+                zcl::t_static_array<zcl::t_i32, 3> values;
+
+                for (zcl::t_i32 i = 0; i < values.k_len; i++) {
+                    values[i] = zcl::RandGenI32InRange(rng, -1000, 1000);
+                }
+
+                const auto inserted = zcl::ListInsertManyAtDynamic(&list, index, zcl::ArrayToNonstatic(&values), temp_arena);
+                ZCL_REQUIRE(inserted.len == values.k_len && inserted.raw == &list[index]);
+
+                for (zcl::t_i32 i = expected_len - 1; i >= index; i--) {
+                    expected[i + values.k_len] = expected[i];
+                }
+
+                for (zcl::t_i32 i = 0; i < values.k_len; i++) {
+                    expected[index + i] = values[i];
+                }
+
+                expected_len += values.k_len;
+            } else if (expected_len > 0) {
+                const zcl::t_i32 index = zcl::RandGenI32InRange(rng, 0, expected_len);
+
+                zcl::ListRemoveAtShift(&list, index);
+
+                for (zcl::t_i32 i = index; i < expected_len - 1; i++) {
+                    expected[i] = expected[i + 1];
+                }
+
+                expected_len--;
+            }
+
+            ZCL_REQUIRE(list.len == expected_len);
+
+            for (zcl::t_i32 i = 0; i < expected_len; i++) {
+                ZCL_REQUIRE(list[i] == expected[i]);
+            }
+        }
+    }
+
+    // A list whose backing array was the last thing pushed to its arena should grow in place.
+    {
+        zcl::t_arena *const arena = zcl::ArenaCreateBlockBased();
+        ZCL_DEFER({ zcl::ArenaDestroy(arena); });
+
+        auto list = zcl::ListCreate<zcl::t_i32>(4, arena);
+        const zcl::t_i32 *const backing_raw = list.backing_arr.raw;
+
+        for (zcl::t_i32 i = 0; i < 64; i++) {
+            zcl::ListAppendDynamic(&list, i, arena);
+        }
+
+        ZCL_REQUIRE(list.backing_arr.raw == backing_raw);
+
+        // Once something else gets pushed after it, growing has to move it.
+        zcl::ArenaPush<zcl::t_i32>(arena);
+        zcl::ListExtend(&list, arena);
+
+        ZCL_REQUIRE(list.backing_arr.raw != backing_raw);
+
+        for (zcl::t_i32 i = 0; i < 64; i++) {
+            ZCL_REQUIRE(list[i] == i);
+        }
+    }
+}
+
+static void TestBitset(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    enum t_op_type {
+        ek_op_type_shift_left,
+        ek_op_type_shift_right,
+        ek_op_type_rotate_left,
+        ek_op_type_rotate_right,
+        ek_op_type_set_range,
+
+        ekm_op_type_cnt
     };
 
-    const auto nums_generator = [rng, temp_arena](const zcl::t_i32 len) -> zcl::t_array_mut<zcl::t_i32> {
-        ZCL_ASSERT(len >= 0);
+    // Every operation is checked against the same operation done naively on an array of booleans.
+    const auto check_matches = [](const zcl::t_bitset_rdonly bs, const zcl::t_array_rdonly<zcl::t_b8> bits, zcl::t_arena *const temp_arena) {
+        zcl::t_i32 set_cnt = 0;
 
-        if (len == 0) {
-            return {};
+        for (zcl::t_i32 i = 0; i < bits.len; i++) {
+            ZCL_REQUIRE(zcl::BitsetCheckSet(bs, i) == bits[i]);
+
+            if (bits[i]) {
+                set_cnt++;
+            }
         }
 
-        const auto result = zcl::ArenaPushArray<zcl::t_i32>(temp_arena, len);
+        ZCL_REQUIRE(zcl::BitsetCountSet(bs) == set_cnt);
+        ZCL_REQUIRE(zcl::BitsetCheckAnySet(bs) == (set_cnt > 0));
+        ZCL_REQUIRE(zcl::BitsetCheckAllSet(bs) == (bits.len > 0 && set_cnt == bits.len));
 
-        for (zcl::t_i32 i = 0; i < result.len; i++) {
-            result[i] = zcl::RandGenI32(rng);
+        const auto indexes = zcl::BitsetLoadIndexesOfSet(bs, temp_arena);
+        ZCL_REQUIRE(indexes.len == set_cnt);
+
+        zcl::t_i32 next_set = zcl::BitsetFindFirstSet(bs);
+        zcl::t_i32 next_unset = zcl::BitsetFindFirstUnset(bs);
+
+        for (zcl::t_i32 i = 0, j = 0; i < bits.len; i++) {
+            if (bits[i]) {
+                ZCL_REQUIRE(indexes[j] == i);
+                ZCL_REQUIRE(next_set == i);
+                next_set = zcl::BitsetFindFirstSet(bs, i + 1);
+                j++;
+            } else {
+                ZCL_REQUIRE(next_unset == i);
+                next_unset = zcl::BitsetFindFirstUnset(bs, i + 1);
+            }
         }
 
-        return result;
+        ZCL_REQUIRE(next_set == -1 && next_unset == -1);
+
+        zcl::t_i32 walk_cnt = 0;
+
+        ZCL_BITSET_WALK_SET(bs, index) {
+            ZCL_REQUIRE(walk_cnt < indexes.len && indexes[walk_cnt] == index);
+            walk_cnt++;
+        }
+
+        ZCL_REQUIRE(walk_cnt == indexes.len);
     };
 
-    for (zcl::t_i32 i = 0; i < ekm_sort_type_cnt; i++) {
-        for (zcl::t_i32 len = 0; len < 128; len++) {
-            const auto nums = nums_generator(len);
+    for (zcl::t_i32 bit_cnt = 0; bit_cnt < 300; bit_cnt++) {
+        for (zcl::t_i32 op_type = 0; op_type < ekm_op_type_cnt; op_type++) {
+            const zcl::t_bitset_mut bs = zcl::BitsetCreate(bit_cnt, temp_arena);
+            const auto bits = zcl::ArenaPushArray<zcl::t_b8>(temp_arena, bit_cnt);
+            const auto bits_before = zcl::ArenaPushArray<zcl::t_b8>(temp_arena, bit_cnt);
+
+            for (zcl::t_i32 i = 0; i < bit_cnt; i++) {
+                if (zcl::RandGenPerc(rng) < 0.5f) {
+                    zcl::BitsetSet(bs, i);
+                    bits[i] = true;
+                }
+            }
+
+            check_matches(bs, bits, temp_arena);
+
+            zcl::ArrayCopy(bits, bits_before);
+
+            const zcl::t_i32 amount = zcl::RandGenI32InRange(rng, 0, static_cast<zcl::t_i16>((2 * bit_cnt) + 2));
+
+            switch (static_cast<t_op_type>(op_type)) {
+                case ek_op_type_shift_left: {
+                    zcl::BitsetShiftLeft(bs, amount);
+
+                    for (zcl::t_i32 i = 0; i < bit_cnt; i++) {
+                        bits[i] = i >= amount && bits_before[i - amount];
+                    }
 
-            switch (static_cast<t_sort_type>(i)) {
-                case ek_sort_type_bubble: {
-                    zcl::RunBubbleSort(nums);
                     break;
                 }
 
-                case ek_sort_type_insertion: {
-                    zcl::RunInsertionSort(nums);
+                case ek_op_type_shift_right: {
+                    zcl::BitsetShiftRight(bs, amount);
+
+                    for (zcl::t_i32 i = 0; i < bit_cnt; i++) {
+                        bits[i] = i + amount < bit_cnt && bits_before[i + amount];
+                    }
+
                     break;
                 }
 
-                case ek_sort_type_selection: {
-                    zcl::RunSelectionSort(nums);
+                case ek_op_type_rotate_left: {
+                    zcl::BitsetRotateLeft(bs, amount);
+
+                    for (zcl::t_i32 i = 0; i < bit_cnt; i++) {
+                        bits[(i + amount) % bit_cnt] = bits_before[i];
+                    }
+
                     break;
                 }
 
-                case ek_sort_type_merge: {
-                    zcl::RunMergeSort(nums, temp_arena);
+                case ek_op_type_rotate_right: {
+                    zcl::BitsetRotateRight(bs, amount);
+
+                    for (zcl::t_i32 i = 0; i < bit_cnt; i++) {
+                        bits[i] = bits_before[(i + amount) % bit_cnt];
+                    }
+
                     break;
                 }
 
-                case ek_sort_type_quick: {
-                    zcl::RunQuickSort(nums);
+                case ek_op_type_set_range: {
+                    if (bit_cnt == 0) {
+                        break;
+                    }
+
+                    const zcl::t_i32 begin = zcl::RandGenI32InRange(rng, 0, static_cast<zcl::t_i16>(bit_cnt));
+                    const zcl::t_i32 end = zcl::RandGenI32InRange(rng, static_cast<zcl::t_i16>(begin), static_cast<zcl::t_i16>(bit_cnt + 1));
+
+                    zcl::BitsetSetRange(bs, begin, end);
+
+                    for (zcl::t_i32 i = begin; i < end; i++) {
+                        bits[i] = true;
+                    }
+
                     break;
                 }
 
-                case ekm_sort_type_cnt: {
+                case ekm_op_type_cnt: {
                     ZCL_UNREACHABLE();
                 }
             }
 
+            check_matches(bs, bits, temp_arena);
+
+            // Check walking with masks applied.
+            {
+                const zcl::t_bitset_mut and_mask = zcl::BitsetCreate(bit_cnt, temp_arena);
+                const zcl::t_bitset_mut andnot_mask = zcl::BitsetCreate(bit_cnt, temp_arena);
+
+                for (zcl::t_i32 i = 0; i < bit_cnt; i++) {
+                    if (zcl::RandGenPerc(rng) < 0.5f) {
+                        zcl::BitsetSet(and_mask, i);
+                    }
+
+                    if (zcl::RandGenPerc(rng) < 0.5f) {
+                        zcl::BitsetSet(andnot_mask, i);
+                    }
+                }
+
+                const zcl::t_static_array<zcl::t_bitset_rdonly, 1> and_masks = {{and_mask}};
+                const zcl::t_static_array<zcl::t_bitset_rdonly, 1> andnot_masks = {{andnot_mask}};
+
+                zcl::t_bitset_walker walker = zcl::BitsetWalkerCreate(bs, zcl::ArrayToNonstatic(&and_masks), zcl::ArrayToNonstatic(&andnot_masks));
+
+                zcl::t_i32 expected_index = -1;
+                zcl::t_i32 index;
+
+                while (zcl::BitsetWalk(&walker, &index)) {
+                    do {
+                        expected_index++;
+                    } while (!(bits[expected_index] && zcl::BitsetCheckSet(and_mask, expected_index) && !zcl::BitsetCheckSet(andnot_mask, expected_index)));
+
+                    ZCL_REQUIRE(index == expected_index);
+                }
+
+                for (zcl::t_i32 i = expected_index + 1; i < bit_cnt; i++) {
+                    ZCL_REQUIRE(!(bits[i] && zcl::BitsetCheckSet(and_mask, i) && !zcl::BitsetCheckSet(andnot_mask, i)));
+                }
+            }
+        }
+    }
+}
+
+static void TestHierarchicalBitset(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    constexpr zcl::t_static_array<zcl::t_i32, 6> k_bit_cnts = {{0, 1, 63, 64, 1000, 100000}};
+
+    for (zcl::t_i32 bci = 0; bci < k_bit_cnts.k_len; bci++) {
+        const zcl::t_i32 bit_cnt = k_bit_cnts[bci];
+
+        const zcl::t_hierarchical_bitset_mut hbs = zcl::HierarchicalBitsetCreate(bit_cnt, temp_arena);
+        const auto bits = zcl::ArenaPushArray<zcl::t_b8>(temp_arena, bit_cnt);
+
+        // Alternate between sparse and dense phases, checking everything against an array of booleans after each.
+        for (zcl::t_i32 phase = 0; phase < 8 && bit_cnt > 0; phase++) {
+            const zcl::t_i32 op_cnt = phase % 2 == 0 ? 8 : bit_cnt;
+
+            for (zcl::t_i32 i = 0; i < op_cnt; i++) {
+                const auto index = static_cast<zcl::t_i32>(zcl::RandGenU32InRange(rng, 0, static_cast<zcl::t_u32>(bit_cnt)));
+
+                if (zcl::RandGenPerc(rng) < 0.6f) {
+                    zcl::HierarchicalBitsetSet(hbs, index);
+                    bits[index] = true;
+                } else {
+                    zcl::HierarchicalBitsetUnset(hbs, index);
+                    bits[index] = false;
+                }
+            }
+
+            if (phase == 4) {
+                const auto begin = static_cast<zcl::t_i32>(zcl::RandGenU32InRange(rng, 0, static_cast<zcl::t_u32>(bit_cnt)));
+                const auto end = static_cast<zcl::t_i32>(zcl::RandGenU32InRange(rng, static_cast<zcl::t_u32>(begin), static_cast<zcl::t_u32>(bit_cnt + 1)));
+
+                zcl::HierarchicalBitsetSetRange(hbs, begin, end);
+
+                for (zcl::t_i32 i = begin; i < end; i++) {
+                    bits[i] = true;
+                }
+            }
+
+            zcl::t_i32 set_cnt = 0;
+
+            for (zcl::t_i32 i = 0; i < bit_cnt; i++) {
+                ZCL_REQUIRE(zcl::HierarchicalBitsetCheckSet(hbs, i) == bits[i]);
+
+                if (bits[i]) {
+                    set_cnt++;
+                }
+            }
+
+            ZCL_REQUIRE(zcl::HierarchicalBitsetCountSet(hbs) == set_cnt);
+            ZCL_REQUIRE(zcl::HierarchicalBitsetCheckAnySet(hbs) == (set_cnt > 0));
+
+            const auto indexes = zcl::HierarchicalBitsetLoadIndexesOfSet(hbs, temp_arena);
+            ZCL_REQUIRE(indexes.len == set_cnt);
+
+            zcl::t_i32 next_set = zcl::HierarchicalBitsetFindFirstSet(hbs);
+            zcl::t_i32 walk_cnt = 0;
+
+            ZCL_HIERARCHICAL_BITSET_WALK_SET(hbs, index) {
+                ZCL_REQUIRE(bits[index] && indexes[walk_cnt] == index && next_set == index);
+                next_set = zcl::HierarchicalBitsetFindFirstSet(hbs, index + 1);
+                walk_cnt++;
+            }
+
+            ZCL_REQUIRE(walk_cnt == set_cnt && next_set == -1);
+        }
+
+        zcl::HierarchicalBitsetUnsetAll(hbs);
+
+        ZCL_REQUIRE(!zcl::HierarchicalBitsetCheckAnySet(hbs) && zcl::HierarchicalBitsetFindFirstSet(hbs) == -1);
+        ZCL_REQUIRE(!zcl::BitsetCheckAnySet(hbs.bits));
+    }
+}
+
+static void TestParallel(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    // Worker counts beyond the hardware thread count are fine, they just get timesliced.
+    constexpr zcl::t_static_array<zcl::t_i32, 3> k_worker_cnts = {{0, 1, 5}};
+    constexpr zcl::t_static_array<zcl::t_i32, 5> k_lens = {{0, 1, 1000, 50000, 200001}};
+
+    for (zcl::t_i32 wci = 0; wci < k_worker_cnts.k_len; wci++) {
+        zcl::t_worker_pool *const pool = zcl::WorkerPoolCreate(k_worker_cnts[wci], temp_arena);
+        ZCL_DEFER({ zcl::WorkerPoolDestroy(pool); });
+
+        for (zcl::t_i32 li = 0; li < k_lens.k_len; li++) {
+            const auto nums = zcl::ArenaPushArray<zcl::t_i32>(temp_arena, k_lens[li]);
+
+            for (zcl::t_i32 i = 0; i < nums.len; i++) {
+                nums[i] = zcl::RandGenI32InRange(rng, -1000, 1000);
+            }
+
+            const auto pred = [](const zcl::t_i32 &num) { return num % 7 == 0; };
+
+            zcl::t_i32 expected_cnt = 0;
+
+            for (zcl::t_i32 i = 0; i < nums.len; i++) {
+                if (pred(nums[i])) {
+                    expected_cnt++;
+                }
+            }
+
+            ZCL_REQUIRE(zcl::ParallelCount(pool, nums, pred) == expected_cnt);
+            ZCL_REQUIRE(zcl::ParallelCheckAny(pool, nums, pred) == (expected_cnt > 0));
+            ZCL_REQUIRE(zcl::ParallelCheckAll(pool, nums, pred) == (nums.len > 0 && expected_cnt == nums.len));
+
+            const auto doubled = zcl::ArenaPushArray<zcl::t_i32>(temp_arena, nums.len);
+            zcl::ParallelTransform(pool, nums, doubled, [](const zcl::t_i32 &num) { return num * 2; });
+
+            for (zcl::t_i32 i = 0; i < nums.len; i++) {
+                ZCL_REQUIRE(doubled[i] == nums[i] * 2);
+            }
+
+            zcl::ParallelSort(pool, nums, temp_arena);
+
             ZCL_REQUIRE(zcl::CheckSorted(nums));
+            ZCL_REQUIRE(zcl::ParallelCount(pool, nums, pred) == expected_cnt);
+        }
+    }
+}
+
+static void TestSlotMap(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    constexpr zcl::t_i32 k_cap = 64;
+    constexpr zcl::t_i32 k_op_cnt = 2000;
+
+    auto slot_map = zcl::SlotMapCreate<zcl::t_i32>(k_cap, temp_arena);
+
+    // Live handles are tracked alongside what their values should be, and removed handles are kept to check they go stale.
+    zcl::t_static_array<zcl::t_slot_map_handle, k_cap> handles;
+    zcl::t_static_array<zcl::t_i32, k_cap> handle_values;
+    zcl::t_i32 handle_cnt = 0;
+
+    auto stale_handles = zcl::ListCreate<zcl::t_slot_map_handle>(1, temp_arena);
+
+    for (zcl::t_i32 op_index = 0; op_index < k_op_cnt; op_index++) {
+        if (zcl::RandGenI32InRange(rng, 0, 2) == 0) {
+            const zcl::t_i32 value = zcl::RandGenI32InRange(rng, -1000, 1000);
+
+            zcl::t_slot_map_handle handle;
+
+            if (!zcl::SlotMapAdd(&slot_map, value, &handle)) {
+                ZCL_REQUIRE(handle_cnt == k_cap);
+                continue;
+            }
+
+            handles[handle_cnt] = handle;
+            handle_values[handle_cnt] = value;
+            handle_cnt++;
+        } else if (handle_cnt > 0) {
+            const zcl::t_i32 index = zcl::RandGenI32InRange(rng, 0, handle_cnt);
+
+            ZCL_REQUIRE(zcl::SlotMapRemove(&slot_map, handles[index]));
+            ZCL_REQUIRE(!zcl::SlotMapRemove(&slot_map, handles[index]));
+
+            zcl::ListAppendDynamic(&stale_handles, handles[index], temp_arena);
 
-            zcl::ArenaRewind(temp_arena);
+            handle_cnt--;
+            handles[index] = handles[handle_cnt];
+            handle_values[index] = handle_values[handle_cnt];
         }
+
+        ZCL_REQUIRE(zcl::SlotMapGetCount(&slot_map) == handle_cnt);
+
+        for (zcl::t_i32 i = 0; i < handle_cnt; i++) {
+            ZCL_REQUIRE(*zcl::SlotMapGet(&slot_map, handles[i]) == handle_values[i]);
+        }
+    }
+
+    for (zcl::t_i32 i = 0; i < stale_handles.len; i++) {
+        ZCL_REQUIRE(!zcl::SlotMapCheckValid(&slot_map, stale_handles[i]));
+    }
+
+    // Every dense value should map back to a live handle.
+    const auto values = zcl::SlotMapGetValues(&slot_map);
+    ZCL_REQUIRE(values.len == handle_cnt);
+
+    for (zcl::t_i32 i = 0; i < values.len; i++) {
+        const zcl::t_slot_map_handle handle = zcl::SlotMapGetHandleOfDense(&slot_map, i);
+        ZCL_REQUIRE(zcl::SlotMapGet(&slot_map, handle) == &values[i]);
     }
+
+    zcl::SlotMapClear(&slot_map);
+    ZCL_REQUIRE(zcl::SlotMapGetCount(&slot_map) == 0);
+
+    for (zcl::t_i32 i = 0; i < handle_cnt; i++) {
+        ZCL_REQUIRE(!zcl::SlotMapCheckValid(&slot_map, handles[i]));
+    }
+
+    ZCL_REQUIRE(!zcl::SlotMapCheckValid(&slot_map, {}));
 }
 
-static void TestList(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+static void TestRings(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
+    constexpr zcl::t_i32 k_cap = 64;
+
+    // Single-threaded, filling and draining past the capacity so positions wrap.
+    {
+        zcl::t_spsc_ring<zcl::t_i32> *const spsc_ring = zcl::SPSCRingCreate<zcl::t_i32>(k_cap, temp_arena);
+        zcl::t_mpmc_ring<zcl::t_i32> *const mpmc_ring = zcl::MPMCRingCreate<zcl::t_i32>(k_cap, temp_arena);
+
+        zcl::t_i32 next_pushed = 0;
+        zcl::t_i32 next_popped = 0;
+
+        for (zcl::t_i32 op_index = 0; op_index < 10000; op_index++) {
+            const zcl::t_i32 value_cnt = next_pushed - next_popped;
+
+            if (zcl::RandGenI32InRange(rng, 0, 2) == 0) {
+                const zcl::t_b8 spsc_pushed = zcl::SPSCRingPush(spsc_ring, next_pushed);
+                const zcl::t_b8 mpmc_pushed = zcl::MPMCRingPush(mpmc_ring, next_pushed);
+
+                ZCL_REQUIRE(spsc_pushed == (value_cnt < k_cap) && mpmc_pushed == spsc_pushed);
+
+                if (spsc_pushed) {
+                    next_pushed++;
+                }
+            } else {
+                zcl::t_i32 spsc_value, mpmc_value;
+                const zcl::t_b8 spsc_popped = zcl::SPSCRingPop(spsc_ring, &spsc_value);
+                const zcl::t_b8 mpmc_popped = zcl::MPMCRingPop(mpmc_ring, &mpmc_value);
+
+                ZCL_REQUIRE(spsc_popped == (value_cnt > 0) && mpmc_popped == spsc_popped);
+
+                if (spsc_popped) {
+                    ZCL_REQUIRE(spsc_value == next_popped && mpmc_value == next_popped);
+                    next_popped++;
+                }
+            }
+        }
+    }
+
+    constexpr zcl::t_i32 k_value_cnt = 100000;
+
+    // One producer thread and one consumer thread. Values have to come out in the order they went in.
+    {
+        zcl::t_spsc_ring<zcl::t_i32> *const ring = zcl::SPSCRingCreate<zcl::t_i32>(k_cap, temp_arena);
+
+        std::thread producer([ring]() {
+            for (zcl::t_i32 i = 0; i < k_value_cnt; i++) {
+                while (!zcl::SPSCRingPush(ring, i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        for (zcl::t_i32 i = 0; i < k_value_cnt; i++) {
+            zcl::t_i32 value;
+
+            while (!zcl::SPSCRingPop(ring, &value)) {
+                std::this_thread::yield();
+            }
+
+            ZCL_REQUIRE(value == i);
+        }
+
+        producer.join();
+    }
+
+    // Several producer threads and several consumer threads. Every value has to come out exactly once.
+    {
+        constexpr zcl::t_i32 k_producer_cnt = 4;
+        constexpr zcl::t_i32 k_consumer_cnt = 4;
+
+        zcl::t_mpmc_ring<zcl::t_i32> *const ring = zcl::MPMCRingCreate<zcl::t_i32>(k_cap, temp_arena);
+
+        const auto popped_cnts = zcl::ArenaPushArray<zcl::t_i32>(temp_arena, k_value_cnt);
+        std::atomic<zcl::t_i32> popped_total = 0;
+
+        // Every task gets its own thread, since producers and consumers wait on each other.
+        zcl::t_worker_pool *const pool = zcl::WorkerPoolCreate(k_producer_cnt + k_consumer_cnt - 1, temp_arena);
+        ZCL_DEFER({ zcl::WorkerPoolDestroy(pool); });
+
+        zcl::WorkerPoolRun(pool, k_producer_cnt + k_consumer_cnt, [ring, popped_cnts, &popped_total](const zcl::t_i32 task_index) {
+            if (task_index < k_producer_cnt) {
+                for (zcl::t_i32 i = task_index; i < k_value_cnt; i += k_producer_cnt) {
+                    while (!zcl::MPMCRingPush(ring, i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            } else {
+                while (popped_total.load() < k_value_cnt) {
+                    zcl::t_i32 value;
+
+                    if (!zcl::MPMCRingPop(ring, &value)) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    std::atomic_ref(popped_cnts[value])++;
+                    popped_total++;
+                }
+            }
+        });
+
+        for (zcl::t_i32 i = 0; i < k_value_cnt; i++) {
+            ZCL_REQUIRE(popped_cnts[i] == 1);
+        }
+    }
 }
 
 static void TestHashMap(zcl::t_rng *const rng, zcl::t_arena *const temp_arena) {
@@ -80,9 +1631,23 @@ struct t_test {
     void (*func)(zcl::t_rng *const rng, zcl::t_arena *const temp_arena);
 };
 
-static const zcl::t_static_array<t_test, 3> g_tests = {{
+static const zcl::t_static_array<t_test, 17> g_tests = {{
     {.title = ZCL_STR_LITERAL("Sorting"), .func = TestSorting},
+    {.title = ZCL_STR_LITERAL("Binary Search"), .func = TestBinarySearch},
+    {.title = ZCL_STR_LITERAL("UTF-8"), .func = TestUTF8},
+    {.title = ZCL_STR_LITERAL("String Interner"), .func = TestStrInterner},
+    {.title = ZCL_STR_LITERAL("String Builder"), .func = TestStrBuilder},
+    {.title = ZCL_STR_LITERAL("Print Format"), .func = TestPrintFormat},
+    {.title = ZCL_STR_LITERAL("Streams"), .func = TestStreams},
+    {.title = ZCL_STR_LITERAL("File Map"), .func = TestFileMap},
+    {.title = ZCL_STR_LITERAL("File Loader"), .func = TestFileLoader},
+    {.title = ZCL_STR_LITERAL("Logger"), .func = TestLogger},
     {.title = ZCL_STR_LITERAL("List"), .func = TestList},
+    {.title = ZCL_STR_LITERAL("Bitset"), .func = TestBitset},
+    {.title = ZCL_STR_LITERAL("Hierarchical Bitset"), .func = TestHierarchicalBitset},
+    {.title = ZCL_STR_LITERAL("Parallel"), .func = TestParallel},
+    {.title = ZCL_STR_LITERAL("Slot Map"), .func = TestSlotMap},
+    {.title = ZCL_STR_LITERAL("Rings"), .func = TestRings},
     {.title = ZCL_STR_LITERAL("Hash Map"), .func = TestHashMap},
 }};
 
@@ -90,15 +1655,19 @@ static void RunTests() {
     zcl::t_arena *const arena = zcl::ArenaCreateBlockBased();
     ZCL_DEFER({ zcl::ArenaDestroy(arena); });
 
-    zcl::t_rng *const rng = zcl::RNGCreate(zcl::RandGenSeed(), arena);
+    // The RNG gets its own arena since the other gets rewound by tests.
+    zcl::t_arena *const rng_arena = zcl::ArenaCreateBlockBased();
+    ZCL_DEFER({ zcl::ArenaDestroy(rng_arena); });
+
+    zcl::t_rng *const rng = zcl::RNGCreate(zcl::RandGenSeed(), rng_arena);
 
     for (zcl::t_i32 i = 0; i < g_tests.k_len; i++) {
-        zcl::Log(ZCL_STR_LITERAL("Running test \"%\"..."), g_tests[i].title);
+        zcl::Log("Running test \"%\"...", g_tests[i].title);
         g_tests[i].func(rng, arena);
         zcl::ArenaRewind(arena);
     }
 
-    zcl::Log(ZCL_STR_LITERAL("All tests completed!"));
+    zcl::Log("All tests completed!");
 }
 
 int main(const int arg_cnt, const char *const *const args) {